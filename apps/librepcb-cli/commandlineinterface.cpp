@@ -34,11 +34,13 @@
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/boards/boardfabricationoutputsettings.h>
 #include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/drc/boarddesignrulecheck.h>
 #include <librepcb/project/bomgenerator.h>
 #include <librepcb/project/erc/ercmsg.h>
 #include <librepcb/project/erc/ercmsglist.h>
 #include <librepcb/project/project.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 #include <algorithm>
@@ -81,6 +83,15 @@ int CommandLineInterface::execute() noexcept {
   const QCommandLineOption versionOption = parser.addVersionOption();
   QCommandLineOption verboseOption("verbose", tr("Verbose output."));
   parser.addOption(verboseOption);
+  QCommandLineOption jobsOption(
+      "jobs",
+      tr("Maximum number of worker threads used for parallelized tasks. If "
+         "not set, the number of CPU cores is used. For '%1', this also "
+         "enables processing the library elements in parallel. It has no "
+         "effect on '%2', the design rule check always runs sequentially.")
+          .arg("open-library", "--drc"),
+      tr("count"));
+  parser.addOption(jobsOption);
   parser.addPositionalArgument("command", tr("The command to execute."));
 
   // Define options for "open-project"
@@ -89,6 +100,22 @@ int CommandLineInterface::execute() noexcept {
       tr("Run the electrical rule check, print all non-approved "
          "warnings/errors and "
          "report failure (exit code = 1) if there are non-approved messages."));
+  QCommandLineOption drcOption(
+      "drc",
+      tr("Run the design rule check on boards, print all messages and report "
+         "failure (exit code = 1) if there are any messages. The boards are "
+         "checked one after another."));
+  QCommandLineOption drcSettingsOption(
+      "drc-settings",
+      tr("Override the default design rule check settings by providing a "
+         "*.lp file containing custom settings."),
+      tr("file"));
+  QCommandLineOption drcReportOption(
+      "drc-report",
+      tr("Write the design rule check messages to given file(s). Existing "
+         "files will be overwritten. Supported file extensions: %1")
+          .arg("json, csv"),
+      tr("file"));
   QCommandLineOption exportSchematicsOption(
       "export-schematics",
       tr("Export schematics to given file(s). Existing files will be "
@@ -124,6 +151,14 @@ int CommandLineInterface::execute() noexcept {
          "containing custom settings. If not set, the settings from the boards "
          "will be used instead."),
       tr("file"));
+  QCommandLineOption optimizeDrillPathsOption(
+      "optimize-drill-paths",
+      tr("Reorder the drill hits in exported Excellon files to reduce the "
+         "travel distance of the drill head."));
+  QCommandLineOption mergeCopperRegionsOption(
+      "merge-copper-regions",
+      tr("Merge all copper of a net into regions when exporting Gerber "
+         "files, to reduce the file size and the load of CAM tools."));
   QCommandLineOption boardOption("board",
                                  tr("The name of the board(s) to export. Can "
                                     "be given multiple times. If not set, "
@@ -170,12 +205,17 @@ int CommandLineInterface::execute() noexcept {
     parser.addPositionalArgument("project",
                                  tr("Path to project file (*.lpp[z])."));
     parser.addOption(ercOption);
+    parser.addOption(drcOption);
+    parser.addOption(drcSettingsOption);
+    parser.addOption(drcReportOption);
     parser.addOption(exportSchematicsOption);
     parser.addOption(exportBomOption);
     parser.addOption(exportBoardBomOption);
     parser.addOption(bomAttributesOption);
     parser.addOption(exportPcbFabricationDataOption);
     parser.addOption(pcbFabricationSettingsOption);
+    parser.addOption(optimizeDrillPathsOption);
+    parser.addOption(mergeCopperRegionsOption);
     parser.addOption(boardOption);
     parser.addOption(saveOption);
     parser.addOption(prjStrictOption);
@@ -228,6 +268,18 @@ int CommandLineInterface::execute() noexcept {
     Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::All);
   }
 
+  // --jobs
+  if (parser.isSet(jobsOption)) {
+    bool ok = false;
+    int jobs = parser.value(jobsOption).toInt(&ok);
+    if ((!ok) || (jobs < 1)) {
+      printErr(tr("Invalid value for option '%1': %2")
+                   .arg("--jobs", parser.value(jobsOption)));
+      return 1;
+    }
+    QThreadPool::globalInstance()->setMaxThreadCount(jobs);
+  }
+
   // Execute command
   bool cmdSuccess = false;
   if (command == "open-project") {
@@ -239,12 +291,17 @@ int CommandLineInterface::execute() noexcept {
     cmdSuccess = openProject(
         positionalArgs.value(0),  // project filepath
         parser.isSet(ercOption),  // run ERC
+        parser.isSet(drcOption),  // run DRC
+        parser.value(drcSettingsOption),  // DRC settings
+        parser.values(drcReportOption),  // DRC report files
         parser.values(exportSchematicsOption),  // export schematics
         parser.values(exportBomOption),  // export generic BOM
         parser.values(exportBoardBomOption),  // export board BOM
         parser.value(bomAttributesOption),  // BOM attributes
         parser.isSet(exportPcbFabricationDataOption),  // export PCB fab. data
         parser.value(pcbFabricationSettingsOption),  // PCB fab. settings
+        parser.isSet(optimizeDrillPathsOption),  // optimize drill paths
+        parser.isSet(mergeCopperRegionsOption),  // merge copper regions
         parser.values(boardOption),  // boards
         parser.isSet(saveOption),  // save project
         parser.isSet(prjStrictOption)  // strict mode
@@ -258,7 +315,8 @@ int CommandLineInterface::execute() noexcept {
     cmdSuccess = openLibrary(positionalArgs.value(0),  // library directory
                              parser.isSet(libAllOption),  // all elements
                              parser.isSet(libSaveOption),  // save
-                             parser.isSet(libStrictOption)  // strict mode
+                             parser.isSet(libStrictOption),  // strict mode
+                             parser.isSet(jobsOption)  // parallel mode
     );
   } else {
     printErr(tr("Internal failure."));
@@ -277,10 +335,12 @@ int CommandLineInterface::execute() noexcept {
  ******************************************************************************/
 
 bool CommandLineInterface::openProject(
-    const QString& projectFile, bool runErc,
+    const QString& projectFile, bool runErc, bool runDrc,
+    const QString& drcSettingsPath, const QStringList& drcReportFiles,
     const QStringList& exportSchematicsFiles, const QStringList& exportBomFiles,
     const QStringList& exportBoardBomFiles, const QString& bomAttributes,
     bool exportPcbFabricationData, const QString& pcbFabricationSettingsPath,
+    bool optimizeDrillPaths, bool mergeCopperRegions,
     const QStringList& boards, bool save, bool strict) const noexcept {
   try {
     bool success = true;
@@ -408,6 +468,14 @@ bool CommandLineInterface::openProject(
       }
     }
 
+    // DRC
+    if (runDrc) {
+      print(tr("Run DRC..."));
+      runDesignRuleCheck(boardList, drcSettingsPath, drcReportFiles,
+                         projectFile, writtenFilesCounter,
+                         success);  // can throw
+    }
+
     // Export BOM
     if (exportBomFiles.count() + exportBoardBomFiles.count() > 0) {
       QList<QPair<QString, bool>> jobs;  // <OutputPath, BoardSpecific>
@@ -491,6 +559,9 @@ bool CommandLineInterface::openProject(
             *board,
             customSettings ? *customSettings
                            : board->getFabricationOutputSettings());
+        grbExport.setParallelExportEnabled(true);
+        grbExport.setDrillPathOptimizationEnabled(optimizeDrillPaths);
+        grbExport.setCopperRegionsMergingEnabled(mergeCopperRegions);
         grbExport.exportAllLayers();  // can throw
         foreach (const FilePath& fp, grbExport.getWrittenFiles()) {
           print(QString("    => '%1'").arg(prettyPath(fp, projectFile)));
@@ -542,10 +613,144 @@ bool CommandLineInterface::openProject(
   }
 }
 
+void CommandLineInterface::runDesignRuleCheck(
+    const QList<Board*>& boards, const QString& settingsPath,
+    const QStringList& reportFiles, const QString& projectFile,
+    QMap<FilePath, int>& writtenFilesCounter, bool& success) const {
+  // Load custom settings
+  BoardDesignRuleCheck::Options options;
+  if (!settingsPath.isEmpty()) {
+    try {
+      qDebug() << "Load custom DRC settings:" << settingsPath;
+      FilePath fp(QFileInfo(settingsPath).absoluteFilePath());
+      options = BoardDesignRuleCheck::Options(
+          SExpression::parse(FileUtils::readFile(fp), fp),
+          qApp->getFileFormatVersion());  // can throw
+    } catch (const Exception& e) {
+      printErr(tr("ERROR: Failed to load custom settings: %1").arg(e.getMsg()));
+      success = false;
+      return;
+    }
+  }
+
+  // Effective settings, written into the JSON report for reproducibility
+  SExpression settingsNode = SExpression::createList("librepcb_drc_settings");
+  options.serialize(settingsNode);
+  QJsonObject jsonSettings;
+  foreach (const SExpression& child, settingsNode.getChildren()) {
+    if (child.isList()) {
+      jsonSettings[child.getName()] =
+          child.getChild("@0").getValue().toDouble();  // can throw
+    }
+  }
+
+  // Run the checks. This is done sequentially in the main thread, independent
+  // of --jobs, since the check modifies the boards (e.g. rebuilding planes and
+  // air wires) and the board items are not thread-safe.
+  QJsonArray jsonBoards;
+  CsvFile csv;
+  csv.setHeader({"Board", "Message", "X", "Y"});
+  foreach (Board* board, boards) {
+    print("  " % tr("Board '%1':").arg(*board->getName()));
+    BoardDesignRuleCheck drc(*board, options);
+    drc.execute();  // can throw
+    QJsonArray jsonStages;
+    foreach (const BoardDesignRuleCheck::StageDuration& stage,
+             drc.getStageDurations()) {
+      print(QString("    %1: %2 ms").arg(stage.first).arg(stage.second));
+      QJsonObject jsonStage;
+      jsonStage["name"] = stage.first;
+      jsonStage["duration_ms"] = stage.second;
+      jsonStages.append(jsonStage);
+    }
+    QStringList messages;
+    QJsonArray jsonMessages;
+    foreach (const BoardDesignRuleCheckMessage& msg, drc.getMessages()) {
+      messages.append(QString("    - [DRC] %1").arg(msg.getMessage()));
+      QJsonArray jsonLocations;
+      Point min, max;
+      bool first = true;
+      foreach (const Path& location, msg.getLocations()) {
+        QJsonArray jsonVertices;
+        foreach (const Vertex& vertex, location.getVertices()) {
+          const Point& pos = vertex.getPos();
+          QJsonObject jsonVertex;
+          jsonVertex["x"] = pos.getX().toMm();
+          jsonVertex["y"] = pos.getY().toMm();
+          jsonVertices.append(jsonVertex);
+          if (first) {
+            min = max = pos;
+            first = false;
+          } else {
+            min = Point(std::min(min.getX(), pos.getX()),
+                        std::min(min.getY(), pos.getY()));
+            max = Point(std::max(max.getX(), pos.getX()),
+                        std::max(max.getY(), pos.getY()));
+          }
+        }
+        jsonLocations.append(jsonVertices);
+      }
+      QJsonObject jsonMessage;
+      jsonMessage["message"] = msg.getMessage();
+      jsonMessage["locations"] = jsonLocations;
+      jsonMessages.append(jsonMessage);
+      Point center = (min + max) / 2;
+      csv.addValue({*board->getName(), msg.getMessage(),
+                    first ? QString() : center.getX().toMmString(),
+                    first ? QString() : center.getY().toMmString()});
+    }
+    print("    " % tr("Messages: %1").arg(messages.count()));
+    // sort messages to increases readability of console output
+    std::sort(messages.begin(), messages.end());
+    foreach (const QString& msg, messages) { printErr(msg); }
+    if (messages.count() > 0) {
+      success = false;
+    }
+    QJsonObject jsonBoard;
+    jsonBoard["name"] = *board->getName();
+    jsonBoard["uuid"] = board->getUuid().toStr();
+    jsonBoard["stages"] = jsonStages;
+    jsonBoard["messages"] = jsonMessages;
+    jsonBoards.append(jsonBoard);
+  }
+
+  // Write reports
+  foreach (const QString& destStr, reportFiles) {
+    print(tr("Write DRC report to '%1'...").arg(destStr));
+    FilePath fp(QFileInfo(destStr).absoluteFilePath());
+    QString suffix = destStr.split('.').last().toLower();
+    if (suffix == "json") {
+      QJsonObject root;
+      root["settings"] = jsonSettings;
+      root["boards"] = jsonBoards;
+      FileUtils::writeFile(fp, QJsonDocument(root).toJson());  // can throw
+      writtenFilesCounter[fp]++;
+    } else if (suffix == "csv") {
+      csv.saveToFile(fp);  // can throw
+      writtenFilesCounter[fp]++;
+    } else {
+      printErr("  " % tr("ERROR: Unknown extension '%1'.").arg(suffix));
+      success = false;
+      continue;
+    }
+    print(QString("  => '%1'").arg(prettyPath(fp, projectFile)));
+  }
+}
+
 bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
-                                       bool save, bool strict) const noexcept {
+                                       bool save, bool strict,
+                                       bool parallel) const noexcept {
   try {
     bool success = true;
+    QElapsedTimer timer;
+    timer.start();
+
+    // Saving is not allowed with an unstable file format. Check this only
+    // once since elements might be processed in worker threads.
+    if (save && failIfFileFormatUnstable()) {
+      success = false;
+      save = false;
+    }
 
     // Open library
     FilePath libFp(QFileInfo(libDir).absoluteFilePath());
@@ -553,119 +758,122 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
 
     std::shared_ptr<TransactionalFileSystem> libFs =
         TransactionalFileSystem::open(libFp, save);  // can throw
+    libFs->setDiskCacheEnabled(true);  // nobody else modifies the library
     Library lib(std::unique_ptr<TransactionalDirectory>(
         new TransactionalDirectory(libFs)));  // can throw
+    LibraryElementResult libResult;
     processLibraryElement(libDir, *libFs, lib, save, strict,
-                          success);  // can throw
+                          libResult);  // can throw
+    printLibraryElementResult(libResult, success);
 
-    // Open all component categories
+    // Open all elements
     if (all) {
-      QStringList elements = lib.searchForElements<ComponentCategory>();
-      print(tr("Process %1 component categories...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        ComponentCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
+      int count = 1;  // the library itself
+      int failed = libResult.errors.isEmpty() ? 0 : 1;
+      processLibraryElements<ComponentCategory>(
+          tr("Process %1 component categories..."), libDir, lib, save, strict,
+          parallel, count, failed, success);  // can throw
+      processLibraryElements<PackageCategory>(
+          tr("Process %1 package categories..."), libDir, lib, save, strict,
+          parallel, count, failed, success);  // can throw
+      processLibraryElements<Symbol>(tr("Process %1 symbols..."), libDir, lib,
+                                     save, strict, parallel, count, failed,
+                                     success);  // can throw
+      processLibraryElements<Package>(tr("Process %1 packages..."), libDir,
+                                      lib, save, strict, parallel, count,
+                                      failed, success);  // can throw
+      processLibraryElements<Component>(tr("Process %1 components..."),
+                                        libDir, lib, save, strict, parallel,
+                                        count, failed, success);  // can throw
+      processLibraryElements<Device>(tr("Process %1 devices..."), libDir, lib,
+                                     save, strict, parallel, count, failed,
+                                     success);  // can throw
+      print(tr("Processed %1 elements (%2 with errors) in %3 ms.")
+                .arg(count)
+                .arg(failed)
+                .arg(timer.elapsed()));
     }
 
-    // Open all package categories
-    if (all) {
-      QStringList elements = lib.searchForElements<PackageCategory>();
-      print(tr("Process %1 package categories...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        PackageCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
-    }
+    return success;
+  } catch (const Exception& e) {
+    printErr(tr("ERROR: %1").arg(e.getMsg()));
+    return false;
+  }
+}
 
-    // Open all symbols
-    if (all) {
-      QStringList elements = lib.searchForElements<Symbol>();
-      print(tr("Process %1 symbols...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Symbol element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
+template <typename ElementType>
+void CommandLineInterface::processLibraryElements(
+    const QString& title, const QString& libDir, const Library& lib,
+    bool save, bool strict, bool parallel, int& count, int& failed,
+    bool& success) const {
+  QElapsedTimer timer;
+  timer.start();
+  QStringList elements = lib.searchForElements<ElementType>();
+  print(title.arg(elements.count()));
+
+  // Note: This function is called from worker threads in parallel mode, so
+  // it must not print anything but return all messages in the result. It
+  // must not throw either, otherwise the remaining jobs could not be waited
+  // for. Everything is captured by value to not reference local variables.
+  FilePath libFp = lib.getDirectory().getAbsPath();
+  auto process = [this, libFp, libDir, save,
+                  strict](const QString& dir) -> LibraryElementResult {
+    LibraryElementResult result;
+    try {
+      FilePath fp = libFp.getPathTo(dir);
+      result.infos.append(tr("Open '%1'...").arg(prettyPath(fp, libDir)));
+      std::shared_ptr<TransactionalFileSystem> fs =
+          TransactionalFileSystem::open(fp, save);  // can throw
+      fs->setDiskCacheEnabled(true);
+      ElementType element(std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(fs)));  // can throw
+      processLibraryElement(libDir, *fs, element, save, strict,
+                            result);  // can throw
+    } catch (const Exception& e) {
+      result.exception.reset(e.clone());
+    } catch (const std::exception& e) {
+      result.exception.reset(new RuntimeError(__FILE__, __LINE__, e.what()));
+    } catch (...) {
+      result.exception.reset(
+          new RuntimeError(__FILE__, __LINE__, tr("Unknown error.")));
     }
+    return result;
+  };
 
-    // Open all packages
-    if (all) {
-      QStringList elements = lib.searchForElements<Package>();
-      print(tr("Process %1 packages...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Package element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
+  // Process all elements and print their results in a deterministic order
+  QList<QFuture<LibraryElementResult>> futures;
+  if (parallel) {
+    foreach (const QString& dir, elements) {
+      futures.append(QtConcurrent::run([process, dir]() {
+        return process(dir);
+      }));
     }
-
-    // Open all components
-    if (all) {
-      QStringList elements = lib.searchForElements<Component>();
-      print(tr("Process %1 components...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Component element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
+  }
+  for (int i = 0; i < elements.count(); ++i) {
+    LibraryElementResult result =
+        parallel ? futures.at(i).result() : process(elements.at(i));
+    if (result.exception) {
+      // wait for all running jobs to not leave them behind while aborting
+      foreach (QFuture<LibraryElementResult> future, futures) {
+        future.waitForFinished();
       }
+      result.exception->raise();
     }
-
-    // Open all devices
-    if (all) {
-      QStringList elements = lib.searchForElements<Device>();
-      print(tr("Process %1 devices...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Device element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
+    printLibraryElementResult(result, success);
+    ++count;
+    if (!result.errors.isEmpty()) {
+      ++failed;
     }
-
-    return success;
-  } catch (const Exception& e) {
-    printErr(tr("ERROR: %1").arg(e.getMsg()));
-    return false;
   }
+  qInfo() << tr("Processed %1 elements in %2 ms.")
+                 .arg(elements.count())
+                 .arg(timer.elapsed());
 }
 
-void CommandLineInterface::processLibraryElement(const QString& libDir,
-                                                 TransactionalFileSystem& fs,
-                                                 LibraryBaseElement& element,
-                                                 bool save, bool strict,
-                                                 bool& success) const {
+void CommandLineInterface::processLibraryElement(
+    const QString& libDir, TransactionalFileSystem& fs,
+    LibraryBaseElement& element, bool save, bool strict,
+    LibraryElementResult& result) const {
   // Save element to transactional file system, if needed
   if (strict || save) {
     element.save();  // can throw
@@ -673,29 +881,23 @@ void CommandLineInterface::processLibraryElement(const QString& libDir,
 
   // Check for non-canonical files (strict mode)
   if (strict) {
-    qInfo() << tr("Check '%1' for non-canonical files...")
-                   .arg(prettyPath(fs.getPath(), libDir));
+    result.infos.append(tr("Check '%1' for non-canonical files...")
+                            .arg(prettyPath(fs.getPath(), libDir)));
 
     QStringList paths = fs.checkForModifications();  // can throw
     // sort file paths to increases readability of console output
     std::sort(paths.begin(), paths.end());
     foreach (const QString& path, paths) {
-      printErr(QString("    - Non-canonical file: %1")
-                   .arg(prettyPath(fs.getAbsPath(path), libDir)));
-    }
-    if (paths.count() > 0) {
-      success = false;
+      result.errors.append(QString("    - Non-canonical file: %1")
+                               .arg(prettyPath(fs.getAbsPath(path), libDir)));
     }
   }
 
   // Save element to file system, if needed
   if (save) {
-    qInfo() << tr("Save '%1'...").arg(prettyPath(fs.getPath(), libDir));
-    if (failIfFileFormatUnstable()) {
-      success = false;
-    } else {
-      fs.save();  // can throw
-    }
+    result.infos.append(
+        tr("Save '%1'...").arg(prettyPath(fs.getPath(), libDir)));
+    fs.save();  // can throw
   }
 
   // Do not propagate changes in the transactional file system to the
@@ -703,6 +905,15 @@ void CommandLineInterface::processLibraryElement(const QString& libDir,
   fs.discardChanges();
 }
 
+void CommandLineInterface::printLibraryElementResult(
+    const LibraryElementResult& result, bool& success) noexcept {
+  foreach (const QString& info, result.infos) { qInfo() << info; }
+  foreach (const QString& error, result.errors) { printErr(error); }
+  if (!result.errors.isEmpty()) {
+    success = false;
+  }
+}
+
 QString CommandLineInterface::prettyPath(const FilePath& path,
                                          const QString& style) noexcept {
   if (QFileInfo(style).isAbsolute()) {
@@ -25,19 +25,27 @@
  ******************************************************************************/
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
 
 class Application;
+class Exception;
 class FilePath;
 class TransactionalFileSystem;
 
 namespace library {
+class Library;
 class LibraryBaseElement;
 }
 
+namespace project {
+class Board;
+}
+
 namespace cli {
 
 /*******************************************************************************
@@ -59,20 +67,49 @@ public:
   // General Methods
   int execute() noexcept;
 
+private:  // Types
+  /**
+   * @brief Console output of processing a library element
+   *
+   * Library elements may be processed in worker threads, thus the output is
+   * collected and printed later in a deterministic order.
+   */
+  struct LibraryElementResult {
+    QStringList infos;  ///< Printed only in verbose mode
+    QStringList errors;  ///< Printed to stderr, leads to failure
+    std::shared_ptr<Exception> exception;  ///< Error which aborted processing
+  };
+
 private:  // Methods
-  bool openProject(const QString& projectFile, bool runErc,
+  bool openProject(const QString& projectFile, bool runErc, bool runDrc,
+                   const QString& drcSettingsPath,
+                   const QStringList& drcReportFiles,
                    const QStringList& exportSchematicsFiles,
                    const QStringList& exportBomFiles,
                    const QStringList& exportBoardBomFiles,
                    const QString& bomAttributes, bool exportPcbFabricationData,
                    const QString& pcbFabricationSettingsPath,
+                   bool optimizeDrillPaths, bool mergeCopperRegions,
                    const QStringList& boards, bool save, bool strict) const
       noexcept;
-  bool openLibrary(const QString& libDir, bool all, bool save,
-                   bool strict) const noexcept;
+  void runDesignRuleCheck(const QList<project::Board*>& boards,
+                          const QString& settingsPath,
+                          const QStringList& reportFiles,
+                          const QString& projectFile,
+                          QMap<FilePath, int>& writtenFilesCounter,
+                          bool& success) const;
+  bool openLibrary(const QString& libDir, bool all, bool save, bool strict,
+                   bool parallel) const noexcept;
+  template <typename ElementType>
+  void processLibraryElements(const QString& title, const QString& libDir,
+                              const library::Library& lib, bool save,
+                              bool strict, bool parallel, int& count,
+                              int& failed, bool& success) const;
   void processLibraryElement(const QString& libDir, TransactionalFileSystem& fs,
                              library::LibraryBaseElement& element, bool save,
-                             bool strict, bool& success) const;
+                             bool strict, LibraryElementResult& result) const;
+  static void printLibraryElementResult(const LibraryElementResult& result,
+                                        bool& success) noexcept;
   static QString prettyPath(const FilePath& path,
                             const QString& style) noexcept;
   static bool failIfFileFormatUnstable() noexcept;
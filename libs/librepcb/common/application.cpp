@@ -164,8 +164,10 @@ Application::Application(int& argc, char** argv) noexcept
       getResourcesFilePath("fontobene"), false,
       &TransactionalFileSystem::RestoreMode::no);
   mStrokeFontPool.reset(new StrokeFontPool(strokeFontsDir));
-  getDefaultStrokeFont();  // ensure that the default font is available (aborts
-                           // if not)
+  // Ensure that the default font is available (aborts if not). This also
+  // starts loading it since it will most likely be needed soon. All other
+  // fonts are loaded when they are requested the first time.
+  getDefaultStrokeFont();
 }
 
 Application::~Application() noexcept {
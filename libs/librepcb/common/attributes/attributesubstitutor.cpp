@@ -38,6 +38,106 @@ namespace librepcb {
 QString AttributeSubstitutor::substitute(QString str,
                                          const AttributeProvider* ap,
                                          FilterFunction filter) noexcept {
+  // Fast path for texts without any variables (the most common case)
+  if (!str.contains(QLatin1String("{{"))) {
+    return str;
+  }
+
+  std::shared_ptr<const CompiledTemplate> tmpl = getCompiledTemplate(str);
+  if (!tmpl->hasVariables) {
+    return str;
+  }
+  QString result;
+  if (evaluate(*tmpl, ap, filter, result)) {
+    return result;
+  } else {
+    return substituteRecursively(str, ap, filter);
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+std::shared_ptr<const AttributeSubstitutor::CompiledTemplate>
+    AttributeSubstitutor::getCompiledTemplate(const QString& text) noexcept {
+  static QMutex mutex;
+  static QHash<QString, std::shared_ptr<const CompiledTemplate>> cache;
+
+  QMutexLocker locker(&mutex);
+  std::shared_ptr<const CompiledTemplate> tmpl = cache.value(text);
+  if (!tmpl) {
+    std::shared_ptr<CompiledTemplate> compiled =
+        std::make_shared<CompiledTemplate>();
+    compiled->hasVariables = false;
+    int startPos = 0;
+    int pos = 0;
+    int length = 0;
+    QStringList keys;
+    while (searchVariablesInText(text, startPos, pos, length, keys)) {
+      if (pos > startPos) {
+        compiled->segments.append({text.mid(startPos, pos - startPos), {}});
+      }
+      compiled->segments.append({QString(), keys});
+      compiled->hasVariables = true;
+      startPos = pos + length;
+    }
+    if (startPos < text.length()) {
+      compiled->segments.append({text.mid(startPos), {}});
+    }
+    // Limit memory usage, e.g. if lots of texts are edited
+    if (cache.count() >= 10000) {
+      cache.clear();
+    }
+    cache.insert(text, compiled);
+    tmpl = compiled;
+  }
+  return tmpl;
+}
+
+bool AttributeSubstitutor::evaluate(const CompiledTemplate& tmpl,
+                                    const AttributeProvider* ap,
+                                    FilterFunction filter,
+                                    QString& result) noexcept {
+  QHash<QString, QString> values;  // avoid multiple lookups of the same key
+  QSet<QString> keyBacktrace;  // same behavior as substituteRecursively()
+  result.clear();
+  foreach (const CompiledTemplate::Segment& segment, tmpl.segments) {
+    if (segment.keys.isEmpty()) {
+      result.append(segment.text);
+      continue;
+    }
+    QString value;
+    foreach (const QString& key, segment.keys) {
+      if (key.startsWith('\'') && key.endsWith('\'')) {
+        // replace "{{'VALUE'}}" with "VALUE"
+        value = key.mid(1, key.length() - 2);
+        break;
+      }
+      auto it = values.find(key);
+      if (it == values.end()) {
+        QString v;
+        getValueOfKey(key, v, ap);
+        it = values.insert(key, v);
+      }
+      if ((!it->isEmpty()) && (!keyBacktrace.contains(key))) {
+        if (it->contains('{')) {
+          // the value might contain variables which need to be substituted
+          return false;
+        }
+        // replace "{{KEY}}" with the value of KEY
+        value = *it;
+        keyBacktrace.insert(key);
+        break;
+      }
+    }
+    result.append(filter ? filter(value) : value);
+  }
+  return true;
+}
+
+QString AttributeSubstitutor::substituteRecursively(
+    QString str, const AttributeProvider* ap, FilterFunction filter) noexcept {
   int startPos = 0;
   int length = 0;
   int outerVariableStart = -1;
@@ -82,15 +182,11 @@ QString AttributeSubstitutor::substitute(QString str,
   return str;
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
 bool AttributeSubstitutor::searchVariablesInText(const QString& text,
                                                  int startPos, int& pos,
                                                  int& length,
                                                  QStringList& keys) noexcept {
-  QRegularExpression re("\\{\\{(.*?)\\}\\}");
+  static const QRegularExpression re("\\{\\{(.*?)\\}\\}");
   QRegularExpressionMatch match = re.match(text, startPos);
   if (match.hasMatch() && match.capturedLength() > 0) {
     pos = match.capturedStart();
@@ -26,6 +26,7 @@
 #include <QtCore>
 
 #include <functional>
+#include <memory>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -85,7 +86,64 @@ public:
   static QString substitute(QString str, const AttributeProvider* ap = nullptr,
                             FilterFunction filter = nullptr) noexcept;
 
+private:  // Types
+  /**
+   * @brief A text which has been split into literal parts and variables
+   *
+   * Parsing a text is done only once per distinct text (see
+   * #getCompiledTemplate()), evaluating it against an attribute provider
+   * then doesn't need any regular expression matching anymore.
+   */
+  struct CompiledTemplate {
+    struct Segment {
+      QString text;  ///< Literal text (only valid if keys is empty)
+      QStringList keys;  ///< Variable keys, empty for literal text
+    };
+    QVector<Segment> segments;
+    bool hasVariables;
+  };
+
 private:  // Methods
+  /**
+   * @brief Get the compiled template of a text (cached by the text)
+   *
+   * @note This method is thread-safe.
+   *
+   * @param text      The text to compile.
+   *
+   * @return The compiled template (never nullptr)
+   */
+  static std::shared_ptr<const CompiledTemplate> getCompiledTemplate(
+      const QString& text) noexcept;
+
+  /**
+   * @brief Evaluate a compiled template
+   *
+   * @param tmpl      The compiled template.
+   * @param ap        The attribute provider for attribute lookup.
+   * @param filter    Filter function, see #substitute().
+   * @param result    The substituted string will be written into this.
+   *
+   * @return False if the template can't be evaluated without re-parsing
+   *         substituted values (i.e. if attribute values contain variables
+   *         themselves), true on success.
+   */
+  static bool evaluate(const CompiledTemplate& tmpl,
+                       const AttributeProvider* ap, FilterFunction filter,
+                       QString& result) noexcept;
+
+  /**
+   * @brief Substitute all attribute keys by re-parsing the string after every
+   * substitution
+   *
+   * Slow, but supports attribute values which contain variables themselves.
+   *
+   * @see #substitute()
+   */
+  static QString substituteRecursively(QString str,
+                                       const AttributeProvider* ap,
+                                       FilterFunction filter) noexcept;
+
   /**
    * @brief Search the next variables (e.g. "{{KEY or FALLBACK}}") in a given
    * text
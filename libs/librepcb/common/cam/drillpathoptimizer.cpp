@@ -0,0 +1,177 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "drillpathoptimizer.h"
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QVector<Point> DrillPathOptimizer::optimize(const QVector<Point>& points,
+                                            const Point& start) noexcept {
+  if (points.count() < 3) {
+    return points;  // nothing to optimize
+  } else if (points.count() > sMaxPointsForTwoOpt) {
+    return hilbertCurve(points);
+  } else {
+    QVector<Point> path = nearestNeighbour(points, start);
+    twoOpt(path, start);
+    return path;
+  }
+}
+
+Length DrillPathOptimizer::calcTravelDistance(const QVector<Point>& points,
+                                              const Point& start) noexcept {
+  qreal sum = 0;
+  Point pos = start;
+  foreach (const Point& p, points) {
+    sum += distance(pos, p);
+    pos = p;
+  }
+  return Length(qRound64(sum));
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QVector<Point> DrillPathOptimizer::nearestNeighbour(
+    const QVector<Point>& points, const Point& start) noexcept {
+  QVector<Point> remaining = points;
+  QVector<Point> path;
+  path.reserve(points.count());
+  Point pos = start;
+  while (!remaining.isEmpty()) {
+    int nearestIndex = 0;
+    qreal nearestDistance = distance(pos, remaining.first());
+    for (int i = 1; i < remaining.count(); ++i) {
+      qreal d = distance(pos, remaining.at(i));
+      if (d < nearestDistance) {
+        nearestIndex = i;
+        nearestDistance = d;
+      }
+    }
+    pos = remaining.at(nearestIndex);
+    path.append(pos);
+    // order of remaining points doesn't matter, so just swap with last
+    remaining[nearestIndex] = remaining.last();
+    remaining.removeLast();
+  }
+  return path;
+}
+
+void DrillPathOptimizer::twoOpt(QVector<Point>& points,
+                                const Point& start) noexcept {
+  // Note: The path is open, i.e. the last point is not connected back to the
+  // start point. Thus reversing a section at the end of the path only changes
+  // one edge.
+  const int n = points.count();
+  for (int pass = 0; pass < sMaxTwoOptPasses; ++pass) {
+    bool improved = false;
+    for (int i = 0; i < n - 1; ++i) {
+      const Point& prev = (i > 0) ? points.at(i - 1) : start;
+      for (int j = i + 1; j < n; ++j) {
+        qreal before = distance(prev, points.at(i));
+        qreal after = distance(prev, points.at(j));
+        if (j < n - 1) {
+          before += distance(points.at(j), points.at(j + 1));
+          after += distance(points.at(i), points.at(j + 1));
+        }
+        if (after < before - 1.0) {  // ignore improvements below 1nm
+          std::reverse(points.begin() + i, points.begin() + j + 1);
+          improved = true;
+        }
+      }
+    }
+    if (!improved) {
+      break;
+    }
+  }
+}
+
+QVector<Point> DrillPathOptimizer::hilbertCurve(
+    const QVector<Point>& points) noexcept {
+  // determine bounding box
+  qreal minX = points.first().getX().toNm();
+  qreal minY = points.first().getY().toNm();
+  qreal maxX = minX;
+  qreal maxY = minY;
+  foreach (const Point& p, points) {
+    minX = qMin(minX, qreal(p.getX().toNm()));
+    minY = qMin(minY, qreal(p.getY().toNm()));
+    maxX = qMax(maxX, qreal(p.getX().toNm()));
+    maxY = qMax(maxY, qreal(p.getY().toNm()));
+  }
+  const qreal size = qMax(qMax(maxX - minX, maxY - minY), qreal(1));
+
+  // map every point to its index on a Hilbert curve of order 16
+  const quint32 n = 1u << 16;
+  QVector<QPair<quint64, int>> keys;
+  keys.reserve(points.count());
+  for (int i = 0; i < points.count(); ++i) {
+    quint32 x = static_cast<quint32>(
+        (points.at(i).getX().toNm() - minX) * (n - 1) / size);
+    quint32 y = static_cast<quint32>(
+        (points.at(i).getY().toNm() - minY) * (n - 1) / size);
+    quint64 d = 0;
+    for (quint32 s = n / 2; s > 0; s /= 2) {
+      quint32 rx = (x & s) ? 1 : 0;
+      quint32 ry = (y & s) ? 1 : 0;
+      d += quint64(s) * s * ((3 * rx) ^ ry);
+      if (ry == 0) {  // rotate quadrant
+        if (rx == 1) {
+          x = n - 1 - x;
+          y = n - 1 - y;
+        }
+        std::swap(x, y);
+      }
+    }
+    keys.append(qMakePair(d, i));
+  }
+  std::sort(keys.begin(), keys.end());  // index as tie-breaker -> stable
+
+  QVector<Point> path;
+  path.reserve(points.count());
+  foreach (const auto& key, keys) { path.append(points.at(key.second)); }
+  return path;
+}
+
+qreal DrillPathOptimizer::distance(const Point& p1, const Point& p2) noexcept {
+  qreal dx = p2.getX().toNm() - p1.getX().toNm();
+  qreal dy = p2.getY().toNm() - p1.getY().toNm();
+  return qSqrt(dx * dx + dy * dy);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,104 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_DRILLPATHOPTIMIZER_H
+#define LIBREPCB_DRILLPATHOPTIMIZER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../units/all_length_units.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class DrillPathOptimizer
+ ******************************************************************************/
+
+/**
+ * @brief Reorders drill hits to reduce the travel distance of the drill head
+ *
+ * For moderate numbers of hits, a nearest-neighbour tour is built and then
+ * improved with 2-opt moves. For very large numbers of hits (where the
+ * quadratic algorithms would take too long), the hits are ordered along a
+ * Hilbert curve instead, which is much cheaper but still avoids zig-zagging
+ * across the whole board.
+ *
+ * The result only depends on the input, i.e. it is deterministic.
+ */
+class DrillPathOptimizer final {
+public:
+  // Constructors / Destructor
+  DrillPathOptimizer() = delete;
+  DrillPathOptimizer(const DrillPathOptimizer& other) = delete;
+  ~DrillPathOptimizer() = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Reorder drill hits to get a short drill path
+   *
+   * @param points    The drill hits (in arbitrary order).
+   * @param start     The position of the drill head before the first hit.
+   *
+   * @return The same points as passed in, but in optimized order.
+   */
+  static QVector<Point> optimize(const QVector<Point>& points,
+                                 const Point& start) noexcept;
+
+  /**
+   * @brief Calculate the total travel distance of a drill path
+   *
+   * @param points    The drill hits in the order they are drilled.
+   * @param start     The position of the drill head before the first hit.
+   *
+   * @return The sum of all distances between consecutive positions.
+   */
+  static Length calcTravelDistance(const QVector<Point>& points,
+                                   const Point& start) noexcept;
+
+  // Operator Overloadings
+  DrillPathOptimizer& operator=(const DrillPathOptimizer& rhs) = delete;
+
+private:  // Methods
+  static QVector<Point> nearestNeighbour(const QVector<Point>& points,
+                                         const Point& start) noexcept;
+  static void twoOpt(QVector<Point>& points, const Point& start) noexcept;
+  static QVector<Point> hilbertCurve(const QVector<Point>& points) noexcept;
+  static qreal distance(const Point& p1, const Point& p2) noexcept;
+
+private:  // Data
+  /// Above this number of hits, the Hilbert curve ordering is used
+  static constexpr int sMaxPointsForTwoOpt = 2000;
+  /// Limit of 2-opt improvement passes
+  static constexpr int sMaxTwoOptPasses = 20;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_DRILLPATHOPTIMIZER_H
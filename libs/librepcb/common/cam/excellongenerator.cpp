@@ -23,6 +23,7 @@
 #include "excellongenerator.h"
 
 #include "../fileio/fileutils.h"
+#include "drillpathoptimizer.h"
 
 #include <QtCore>
 
@@ -35,7 +36,8 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-ExcellonGenerator::ExcellonGenerator() noexcept : mOutput() {
+ExcellonGenerator::ExcellonGenerator() noexcept
+  : mOptimizePath(false), mOutput() {
 }
 
 ExcellonGenerator::~ExcellonGenerator() noexcept {
@@ -98,10 +100,16 @@ void ExcellonGenerator::printToolList() noexcept {
 }
 
 void ExcellonGenerator::printDrills() noexcept {
-  for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
+  Point headPosition(0, 0);
+  QList<Length> diameters = mDrillList.uniqueKeys();
+  for (int i = 0; i < diameters.count(); ++i) {
     mOutput.append(QString("T%1\n").arg(i + 1));  // Select Tool
-    Length dia = mDrillList.uniqueKeys().value(i);
-    foreach (const Point& pos, mDrillList.values(dia)) {
+    QVector<Point> positions = mDrillList.values(diameters.at(i)).toVector();
+    if (mOptimizePath && (!positions.isEmpty())) {
+      positions = DrillPathOptimizer::optimize(positions, headPosition);
+      headPosition = positions.last();
+    }
+    foreach (const Point& pos, positions) {
       mOutput.append(
           QString("X%1Y%2\n")
               .arg(pos.getX().toMmString(), pos.getY().toMmString()));
@@ -54,6 +54,21 @@ public:
   // Getters
   const QString& toStr() const noexcept { return mOutput; }
 
+  // Setters
+
+  /**
+   * @brief Enable or disable the drill path optimization
+   *
+   * If enabled, the drill hits of each tool are reordered by
+   * ::librepcb::DrillPathOptimizer to reduce the travel distance of the
+   * drill head. Otherwise they are emitted in the order they were added.
+   *
+   * @param enabled   Whether to optimize the drill path or not.
+   */
+  void setPathOptimizationEnabled(bool enabled) noexcept {
+    mOptimizePath = enabled;
+  }
+
   // General Methods
   void drill(const Point& pos, const PositiveLength& dia) noexcept;
   void generate();
@@ -69,6 +84,9 @@ private:
   void printDrills() noexcept;
   void printFooter() noexcept;
 
+  // Settings
+  bool mOptimizePath;
+
   // Excellon Data
   QString mOutput;
   QMultiMap<Length, Point> mDrillList;
@@ -46,12 +46,20 @@ GerberApertureList::~GerberApertureList() noexcept {
 QString GerberApertureList::generateString() const noexcept {
   QString str;
   str.append("G04 --- APERTURE LIST BEGIN --- *\n");
-  foreach (const QString& macro, mApertureMacros) {
+  QStringList macros;
+  foreach (const Aperture& aperture, mApertures) {
+    QString macro = generateMacro(aperture.shape, aperture.hole > 0);
+    if ((!macro.isEmpty()) && (!macros.contains(macro))) {
+      macros.append(macro);
+    }
+  }
+  foreach (const QString& macro, macros) {
     str.append(QString("%AM%1*%\n").arg(macro));
   }
-  foreach (int number, mApertures.keys()) {
-    str.append(
-        QString("%ADD%1%2*%\n").arg(number).arg(mApertures.value(number)));
+  for (int i = 0; i < mApertures.count(); ++i) {
+    str.append(QString("%ADD%1%2*%\n")
+                   .arg(i + 10)  // 10 is the number of the first aperture
+                   .arg(generateAperture(mApertures.at(i))));
   }
   str.append("G04 --- APERTURE LIST END --- *\n");
   return str;
@@ -63,25 +71,24 @@ QString GerberApertureList::generateString() const noexcept {
 
 int GerberApertureList::setCircle(const UnsignedLength& dia,
                                   const UnsignedLength& hole) {
-  return setCurrentAperture(generateCircle(dia, hole));
+  return setCurrentAperture(
+      Aperture{Shape::Circle, *dia, 0, 0, 0, Angle::deg0(), *hole});
 }
 
 int GerberApertureList::setRect(const UnsignedLength& w,
                                 const UnsignedLength& h, const Angle& rot,
                                 const UnsignedLength& hole) noexcept {
   if (rot % Angle::deg180() == 0) {
-    return setCurrentAperture(generateRect(w, h, hole));
+    return setCurrentAperture(
+        Aperture{Shape::Rect, *w, *h, 0, 0, Angle::deg0(), *hole});
   } else if (rot % Angle::deg90() == 0) {
-    return setCurrentAperture(generateRect(h, w, hole));
+    return setCurrentAperture(
+        Aperture{Shape::Rect, *h, *w, 0, 0, Angle::deg0(), *hole});
   } else {
     // Rotation is not a multiple of 90 degrees --> we need to use an aperture
     // macro
-    if (hole > 0) {
-      addMacro(generateRotatedRectMacroWithHole());
-    } else {
-      addMacro(generateRotatedRectMacro());
-    }
-    return setCurrentAperture(generateRotatedRect(w, h, rot, hole));
+    return setCurrentAperture(
+        Aperture{Shape::RotatedRect, *w, *h, 0, 0, rot, *hole});
   }
 }
 
@@ -89,18 +96,16 @@ int GerberApertureList::setObround(const UnsignedLength& w,
                                    const UnsignedLength& h, const Angle& rot,
                                    const UnsignedLength& hole) noexcept {
   if (rot % Angle::deg180() == 0) {
-    return setCurrentAperture(generateObround(w, h, hole));
+    return setCurrentAperture(
+        Aperture{Shape::Obround, *w, *h, 0, 0, Angle::deg0(), *hole});
   } else if (rot % Angle::deg90() == 0) {
-    return setCurrentAperture(generateObround(h, w, hole));
+    return setCurrentAperture(
+        Aperture{Shape::Obround, *h, *w, 0, 0, Angle::deg0(), *hole});
   } else {
     // Rotation is not a multiple of 90 degrees --> we need to use an aperture
     // macro
-    if (hole > 0) {
-      addMacro(generateRotatedObroundMacroWithHole());
-    } else {
-      addMacro(generateRotatedObroundMacro());
-    }
-    return setCurrentAperture(generateRotatedObround(w, h, rot, hole));
+    return setCurrentAperture(
+        Aperture{Shape::RotatedObround, *w, *h, 0, 0, rot, *hole});
   }
 }
 
@@ -115,50 +120,86 @@ int GerberApertureList::setRegularPolygon(const UnsignedLength& dia, int n,
   // Adjust rotation as its interpretation differs between LibrePCB and Gerber
   // specs
   Angle grbRot = rot + (Angle::deg180() / (n > 0 ? n : 1));
-  return setCurrentAperture(generateRegularPolygon(dia, n, grbRot, hole));
+  return setCurrentAperture(
+      Aperture{Shape::RegularPolygon, *dia, 0, 0, n, grbRot, *hole});
 }
 
 int GerberApertureList::setOctagon(const UnsignedLength& w,
                                    const UnsignedLength& h,
                                    const UnsignedLength& edge, const Angle& rot,
                                    const UnsignedLength& hole) noexcept {
-  if (hole > 0) {
-    addMacro(generateRotatedOctagonMacroWithHole());
-  } else {
-    addMacro(generateRotatedOctagonMacro());
-  }
-  return setCurrentAperture(generateRotatedOctagon(w, h, edge, rot, hole));
+  return setCurrentAperture(
+      Aperture{Shape::RotatedOctagon, *w, *h, *edge, 0, rot, *hole});
 }
 
 void GerberApertureList::reset() noexcept {
-  // mApertureMacros.clear();
   mApertures.clear();
+  mApertureNumbers.clear();
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-int GerberApertureList::setCurrentAperture(const QString& aperture) noexcept {
-  int number = mApertures.key(aperture, -1);
+int GerberApertureList::setCurrentAperture(const Aperture& aperture) noexcept {
+  int number = mApertureNumbers.value(aperture, -1);
   if (number < 0) {
     number = mApertures.count() + 10;  // 10 is the number of the first aperture
-    Q_ASSERT(!mApertures.contains(number));
-    mApertures.insert(number, aperture);
+    mApertures.append(aperture);
+    mApertureNumbers.insert(aperture, number);
   }
   return number;
 }
 
-void GerberApertureList::addMacro(const QString& macro) noexcept {
-  if (!mApertureMacros.contains(macro)) {
-    mApertureMacros.append(macro);
-  }
-}
-
 /*******************************************************************************
  *  Aperture Generator Methods
  ******************************************************************************/
 
+QString GerberApertureList::generateAperture(const Aperture& a) noexcept {
+  UnsignedLength hole(a.hole);
+  switch (a.shape) {
+    case Shape::Circle:
+      return generateCircle(UnsignedLength(a.dim1), hole);
+    case Shape::Rect:
+      return generateRect(UnsignedLength(a.dim1), UnsignedLength(a.dim2), hole);
+    case Shape::Obround:
+      return generateObround(UnsignedLength(a.dim1), UnsignedLength(a.dim2),
+                             hole);
+    case Shape::RegularPolygon:
+      return generateRegularPolygon(UnsignedLength(a.dim1), a.vertices,
+                                    a.rotation, hole);
+    case Shape::RotatedRect:
+      return generateRotatedRect(UnsignedLength(a.dim1), UnsignedLength(a.dim2),
+                                 a.rotation, hole);
+    case Shape::RotatedObround:
+      return generateRotatedObround(UnsignedLength(a.dim1),
+                                    UnsignedLength(a.dim2), a.rotation, hole);
+    case Shape::RotatedOctagon:
+      return generateRotatedOctagon(UnsignedLength(a.dim1),
+                                    UnsignedLength(a.dim2),
+                                    UnsignedLength(a.dim3), a.rotation, hole);
+    default:
+      qCritical() << "Unhandled aperture shape:" << static_cast<int>(a.shape);
+      return QString();
+  }
+}
+
+QString GerberApertureList::generateMacro(Shape shape, bool withHole) noexcept {
+  switch (shape) {
+    case Shape::RotatedRect:
+      return withHole ? generateRotatedRectMacroWithHole()
+                      : generateRotatedRectMacro();
+    case Shape::RotatedObround:
+      return withHole ? generateRotatedObroundMacroWithHole()
+                      : generateRotatedObroundMacro();
+    case Shape::RotatedOctagon:
+      return withHole ? generateRotatedOctagonMacroWithHole()
+                      : generateRotatedOctagonMacro();
+    default:
+      return QString();  // no macro needed
+  }
+}
+
 QString GerberApertureList::generateCircle(
     const UnsignedLength& dia, const UnsignedLength& hole) noexcept {
   if (hole > 0) {
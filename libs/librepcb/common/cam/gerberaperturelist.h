@@ -41,6 +41,11 @@ namespace librepcb {
 
 /**
  * @brief The GerberApertureList class
+ *
+ * Apertures are identified by a compact key (shape, dimensions, rotation,
+ * hole) which is looked up in a hash index, thus adding an already existing
+ * aperture (e.g. for every flashed pad) is cheap. The textual aperture
+ * definitions are only generated once by #generateString().
  */
 class GerberApertureList final {
   Q_DECLARE_TR_FUNCTIONS(GerberApertureList)
@@ -72,11 +77,55 @@ public:
   GerberApertureList& operator=(const GerberApertureList& rhs) = delete;
 
 private:
+  // Private Types
+  enum class Shape {
+    Circle,
+    Rect,
+    Obround,
+    RegularPolygon,
+    RotatedRect,
+    RotatedObround,
+    RotatedOctagon,
+  };
+
+  /**
+   * @brief Compact key of an aperture
+   *
+   * The meaning of the dimensions depends on the shape, see the
+   * corresponding setters and generator methods.
+   */
+  struct Aperture {
+    Shape shape;
+    Length dim1;
+    Length dim2;
+    Length dim3;
+    int vertices;
+    Angle rotation;
+    Length hole;
+
+    bool operator==(const Aperture& rhs) const noexcept {
+      return (shape == rhs.shape) && (dim1 == rhs.dim1) &&
+          (dim2 == rhs.dim2) && (dim3 == rhs.dim3) &&
+          (vertices == rhs.vertices) && (rotation == rhs.rotation) &&
+          (hole == rhs.hole);
+    }
+    friend uint qHash(const Aperture& key, uint seed = 0) noexcept {
+      seed = ::qHash(static_cast<int>(key.shape), seed);
+      seed = ::qHash(key.dim1.toNm(), seed);
+      seed = ::qHash(key.dim2.toNm(), seed);
+      seed = ::qHash(key.dim3.toNm(), seed);
+      seed = ::qHash(key.vertices, seed);
+      seed = ::qHash(key.rotation.toMicroDeg(), seed);
+      return ::qHash(key.hole.toNm(), seed);
+    }
+  };
+
   // Private Methods
-  int setCurrentAperture(const QString& aperture) noexcept;
-  void addMacro(const QString& macro) noexcept;
+  int setCurrentAperture(const Aperture& aperture) noexcept;
 
   // Aperture Generator Methods
+  static QString generateAperture(const Aperture& a) noexcept;
+  static QString generateMacro(Shape shape, bool withHole) noexcept;
   static QString generateCircle(const UnsignedLength& dia,
                                 const UnsignedLength& hole) noexcept;
   static QString generateRect(const UnsignedLength& w, const UnsignedLength& h,
@@ -106,9 +155,10 @@ private:
                                         const Angle& rot,
                                         const UnsignedLength& hole) noexcept;
 
-  QList<QString> mApertureMacros;
-  QMap<int, QString>
-      mApertures;  ///< key: aperture number (>= 10); value: aperture definition
+  /// All apertures, the index + 10 is the aperture number
+  QVector<Aperture> mApertures;
+  /// Hash index of #mApertures (value: aperture number)
+  QHash<Aperture, int> mApertureNumbers;
 };
 
 /*******************************************************************************
@@ -30,6 +30,8 @@
 
 #include <QtCore>
 
+#include <cstring>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -175,12 +177,46 @@ void GerberGenerator::generate() {
   mOutput.clear();
   printHeader();
   printApertureList();
-  printContent();
-  printFooter();
+}
+
+QByteArray GerberGenerator::toByteArray() const {
+  QBuffer buffer;
+  buffer.open(QIODevice::WriteOnly);
+  writeTo(buffer);  // can throw
+  return buffer.data();
+}
+
+void GerberGenerator::writeTo(QIODevice& device) const {
+  // The board content is not copied into the output, but streamed directly
+  // into the device. The MD5 checksum is calculated on the fly.
+  QCryptographicHash md5(QCryptographicHash::Md5);
+  write(device, &md5, mOutput);  // can throw
+  write(device, &md5, "G04 --- BOARD BEGIN --- *\n");  // can throw
+  write(device, &md5, mContent);  // can throw
+  write(device, &md5, "G04 --- BOARD END --- *\n");  // can throw
+
+  // MD5 checksum over content
+  QByteArray footer = "%TF.MD5," + md5.result().toHex() + "*%\n";
+
+  // end of file
+  footer += "M02*\n";
+  write(device, nullptr, footer);  // can throw
 }
 
 void GerberGenerator::saveToFile(const FilePath& filepath) const {
-  FileUtils::writeFile(filepath, mOutput.toLatin1());  // can throw
+  FileUtils::makePath(filepath.getParentDir());  // can throw
+  QSaveFile file(filepath.toStr());
+  if (!file.open(QIODevice::WriteOnly)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not open or create file \"%1\": %2")
+                           .arg(filepath.toNative(), file.errorString()));
+  }
+  writeTo(file);  // can throw
+  if (!file.commit()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not write to file \"%1\": %2")
+                           .arg(filepath.toNative(), file.errorString()));
+  }
 }
 
 /*******************************************************************************
@@ -189,7 +225,9 @@ void GerberGenerator::saveToFile(const FilePath& filepath) const {
 
 void GerberGenerator::setCurrentAperture(int number) noexcept {
   if (number != mCurrentApertureNumber) {
-    mContent.append(QString("D%1*\n").arg(number));
+    mContent.append('D');
+    mContent.append(QByteArray::number(number));
+    mContent.append("*\n");
     mCurrentApertureNumber = number;
   }
 }
@@ -229,13 +267,11 @@ void GerberGenerator::switchToCircularCcwInterpolationModeG03() noexcept {
 }
 
 void GerberGenerator::moveToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D02*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendCoordinates(pos, "D02*\n");
 }
 
 void GerberGenerator::linearInterpolateToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D01*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendCoordinates(pos, "D01*\n");
 }
 
 void GerberGenerator::circularInterpolateToPosition(const Point& start,
@@ -245,9 +281,15 @@ void GerberGenerator::circularInterpolateToPosition(const Point& start,
   if (!mMultiQuadrantArcModeOn) {
     diff.makeAbs();  // no sign allowed in single quadrant mode!
   }
-  mContent.append(QString("X%1Y%2I%3J%4D01*\n")
-                      .arg(end.getX().toNmString(), end.getY().toNmString(),
-                           diff.getX().toNmString(), diff.getY().toNmString()));
+  mContent.append('X');
+  appendNumber(end.getX().toNm());
+  mContent.append('Y');
+  appendNumber(end.getY().toNm());
+  mContent.append('I');
+  appendNumber(diff.getX().toNm());
+  mContent.append('J');
+  appendNumber(diff.getY().toNm());
+  mContent.append("D01*\n");
 }
 
 void GerberGenerator::interpolateBetween(const Vertex& from,
@@ -274,8 +316,34 @@ void GerberGenerator::interpolateBetween(const Vertex& from,
 }
 
 void GerberGenerator::flashAtPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D03*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendCoordinates(pos, "D03*\n");
+}
+
+void GerberGenerator::appendCoordinates(const Point& pos,
+                                        const char* command) noexcept {
+  mContent.append('X');
+  appendNumber(pos.getX().toNm());
+  mContent.append('Y');
+  appendNumber(pos.getY().toNm());
+  mContent.append(command);
+}
+
+void GerberGenerator::appendNumber(LengthBase_t value) noexcept {
+  // Fast integer to ASCII conversion since this is called millions of times
+  // for large boards (QString::number() & co. are quite expensive).
+  char buffer[24];
+  char* const end = buffer + sizeof(buffer);
+  char* p = end;
+  quint64 abs = (value < 0) ? (quint64(0) - static_cast<quint64>(value))
+                            : static_cast<quint64>(value);
+  do {
+    *--p = static_cast<char>('0' + (abs % 10));
+    abs /= 10;
+  } while (abs > 0);
+  if (value < 0) {
+    *--p = '-';
+  }
+  mContent.append(p, static_cast<int>(end - p));
 }
 
 void GerberGenerator::printHeader() noexcept {
@@ -288,10 +356,13 @@ void GerberGenerator::printHeader() noexcept {
   QString projUuid = mProjectUuid.toStr();
   QString projRevision = mProjectRevision.remove(',');
   mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n")
-                     .arg(appVersion));
-  mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
+                     .arg(appVersion)
+                     .toLatin1());
+  mOutput.append(
+      QString("%TF.CreationDate,%1*%\n").arg(creationDate).toLatin1());
   mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n")
-                     .arg(projId, projUuid, projRevision));
+                     .arg(projId, projUuid, projRevision)
+                     .toLatin1());
   mOutput.append("%TF.Part,Single*%\n");  // "Single" means "this is a PCB"
   // mOutput.append("%TF.FilePolarity,Positive*%\n");
 
@@ -315,29 +386,7 @@ void GerberGenerator::printHeader() noexcept {
 }
 
 void GerberGenerator::printApertureList() noexcept {
-  mOutput.append(mApertureList->generateString());
-}
-
-void GerberGenerator::printContent() noexcept {
-  mOutput.append("G04 --- BOARD BEGIN --- *\n");
-  mOutput.append(mContent);
-  mOutput.append("G04 --- BOARD END --- *\n");
-}
-
-void GerberGenerator::printFooter() noexcept {
-  // MD5 checksum over content
-  mOutput.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()));
-
-  // end of file
-  mOutput.append("M02*\n");
-}
-
-QString GerberGenerator::calcOutputMd5Checksum() const noexcept {
-  // according to the RS-274C standard, linebreaks are not included in the
-  // checksum
-  QString data = QString(mOutput).remove(QChar('\n'));
-  return QString(
-      QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+  mOutput.append(mApertureList->generateString().toLatin1());
 }
 
 /*******************************************************************************
@@ -358,6 +407,31 @@ QString GerberGenerator::escapeString(const QString& str) noexcept {
   return ret;
 }
 
+void GerberGenerator::write(QIODevice& device, QCryptographicHash* md5,
+                            const QByteArray& data) {
+  if (device.write(data) != data.size()) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("Failed to write Gerber data: %1").arg(device.errorString()));
+  }
+
+  if (!md5) {
+    return;
+  }
+
+  // according to the RS-274C standard, linebreaks are not included in the
+  // checksum
+  const char* begin = data.constData();
+  const char* const end = begin + data.size();
+  while (begin < end) {
+    const char* lineEnd = static_cast<const char*>(
+        std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+    if (!lineEnd) lineEnd = end;
+    md5->addData(begin, static_cast<int>(lineEnd - begin));
+    begin = lineEnd + 1;
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
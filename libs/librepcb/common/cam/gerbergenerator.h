@@ -69,7 +69,7 @@ public:
   ~GerberGenerator() noexcept;
 
   // Getters
-  const QString& toStr() const noexcept { return mOutput; }
+  QByteArray toByteArray() const;
 
   // Plot Methods
   void setLayerPolarity(LayerPolarity p) noexcept;
@@ -98,6 +98,7 @@ public:
   // General Methods
   void reset() noexcept;
   void generate();
+  void writeTo(QIODevice& device) const;
   void saveToFile(const FilePath& filepath) const;
 
   // Operator Overloadings
@@ -119,14 +120,15 @@ private:
                                      const Point& end) noexcept;
   void interpolateBetween(const Vertex& from, const Vertex& to) noexcept;
   void flashAtPosition(const Point& pos) noexcept;
+  void appendCoordinates(const Point& pos, const char* command) noexcept;
+  void appendNumber(LengthBase_t value) noexcept;
   void printHeader() noexcept;
   void printApertureList() noexcept;
-  void printContent() noexcept;
-  void printFooter() noexcept;
-  QString calcOutputMd5Checksum() const noexcept;
 
   // Static Methods
   static QString escapeString(const QString& str) noexcept;
+  static void write(QIODevice& device, QCryptographicHash* md5,
+                    const QByteArray& data);
 
   // Metadata
   QString mProjectId;
@@ -134,8 +136,8 @@ private:
   QString mProjectRevision;
 
   // Gerber Data
-  QString mOutput;
-  QString mContent;
+  QByteArray mOutput;  ///< Header and aperture list (set by #generate())
+  QByteArray mContent;  ///< Board content, plotted as ASCII commands
   QScopedPointer<GerberApertureList> mApertureList;
   int mCurrentApertureNumber;
   bool mMultiQuadrantArcModeOn;
@@ -53,6 +53,7 @@ SOURCES += \
     boarddesignrules.cpp \
     bom/bom.cpp \
     bom/bomcsvwriter.cpp \
+    cam/drillpathoptimizer.cpp \
     cam/excellongenerator.cpp \
     cam/gerberaperturelist.cpp \
     cam/gerbergenerator.cpp \
@@ -189,6 +190,7 @@ HEADERS += \
     boarddesignrules.h \
     bom/bom.h \
     bom/bomcsvwriter.h \
+    cam/drillpathoptimizer.h \
     cam/excellongenerator.h \
     cam/gerberaperturelist.h \
     cam/gerbergenerator.h \
@@ -36,6 +36,9 @@
 #include <quazip/quazipfile.h>
 #endif
 
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -52,7 +55,8 @@ TransactionalFileSystem::TransactionalFileSystem(
     mFilePath(filepath),
     mIsWritable(writable),
     mLock(filepath),
-    mRestoredFromAutosave(false) {
+    mRestoredFromAutosave(false),
+    mDiskCacheEnabled(false) {
   // Load the backup if there is one (i.e. last save operation has failed).
   FilePath backupFile = mFilePath.getPathTo(".backup/backup.lp");
   if (backupFile.isExistingFile()) {
@@ -109,21 +113,17 @@ QStringList TransactionalFileSystem::getDirs(const QString& path) const
   if (!dirpath.isEmpty()) dirpath.append("/");
 
   // add directories from file system, if not removed
-  QDir dir(mFilePath.getPathTo(path).toStr());
-  foreach (const QString& dirname,
-           dir.entryList(QDir::Dirs | QDir::Hidden | QDir::NoDotAndDotDot)) {
+  foreach (const QString& dirname, getDiskDir(dirpath).dirs) {
     if (!isRemoved(dirpath % dirname % "/")) {
       dirnames.insert(dirname);
     }
   }
 
   // add directories of new files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    if (filepath.startsWith(dirpath)) {
-      QStringList relpath = filepath.mid(dirpath.length()).split('/');
-      if (relpath.count() > 1) {
-        dirnames.insert(relpath.first());
-      }
+  auto it = mModifiedDirs.constFind(dirpath);
+  if (it != mModifiedDirs.constEnd()) {
+    for (auto d = it->dirs.constBegin(); d != it->dirs.constEnd(); ++d) {
+      dirnames.insert(d.key());
     }
   }
 
@@ -137,21 +137,16 @@ QStringList TransactionalFileSystem::getFiles(const QString& path) const
   if (!dirpath.isEmpty()) dirpath.append("/");
 
   // add files from file system, if not removed
-  QDir dir(mFilePath.getPathTo(path).toStr());
-  foreach (const QString& filename, dir.entryList(QDir::Files | QDir::Hidden)) {
+  foreach (const QString& filename, getDiskDir(dirpath).files) {
     if (!isRemoved(dirpath % filename)) {
       filenames.insert(filename);
     }
   }
 
   // add new files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    if (filepath.startsWith(dirpath)) {
-      QStringList relpath = filepath.mid(dirpath.length()).split('/');
-      if (relpath.count() == 1) {
-        filenames.insert(relpath.first());
-      }
-    }
+  auto it = mModifiedDirs.constFind(dirpath);
+  if (it != mModifiedDirs.constEnd()) {
+    filenames.unite(it->files);
   }
 
   return filenames.values();
@@ -184,23 +179,36 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
 void TransactionalFileSystem::write(const QString& path,
                                     const QByteArray& content) {
   QString cleanedPath = cleanPath(path);
-  mModifiedFiles[cleanedPath] = content;
+  insertModifiedFile(cleanedPath, content);
   mRemovedFiles.remove(cleanedPath);
 }
 
 void TransactionalFileSystem::removeFile(const QString& path) {
   QString cleanedPath = cleanPath(path);
-  mModifiedFiles.remove(cleanedPath);
+  removeModifiedFile(cleanedPath);
   mRemovedFiles.insert(cleanedPath);
 }
 
 void TransactionalFileSystem::removeDirRecursively(const QString& path) {
   QString dirpath = cleanPath(path);
   if (!dirpath.isEmpty()) dirpath.append("/");
-  foreach (const QString& fp, mModifiedFiles.keys()) {
-    if (dirpath.isEmpty() || fp.startsWith(dirpath)) {
-      mModifiedFiles.remove(fp);
+  if (dirpath.isEmpty()) {
+    clearModifiedFiles();
+  } else {
+    // collect all new files within the directory from the index
+    QStringList files;
+    QStringList dirs = {dirpath};
+    while (!dirs.isEmpty()) {
+      QString dir = dirs.takeLast();
+      auto it = mModifiedDirs.constFind(dir);
+      if (it != mModifiedDirs.constEnd()) {
+        foreach (const QString& file, it->files) { files.append(dir % file); }
+        for (auto d = it->dirs.constBegin(); d != it->dirs.constEnd(); ++d) {
+          dirs.append(dir % d.key() % "/");
+        }
+      }
     }
+    foreach (const QString& fp, files) { removeModifiedFile(fp); }
   }
   foreach (const QString& fp, mRemovedFiles) {
     if (dirpath.isEmpty() || fp.startsWith(dirpath)) {
@@ -210,6 +218,17 @@ void TransactionalFileSystem::removeDirRecursively(const QString& path) {
   mRemovedDirs.insert(dirpath);
 }
 
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void TransactionalFileSystem::setDiskCacheEnabled(bool enabled) noexcept {
+  mDiskCacheEnabled = enabled;
+  if (!enabled) {
+    mDiskCache.clear();
+  }
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -285,7 +304,7 @@ void TransactionalFileSystem::exportToZip(const FilePath& fp) const {
 }
 
 void TransactionalFileSystem::discardChanges() noexcept {
-  mModifiedFiles.clear();
+  clearModifiedFiles();
   mRemovedFiles.clear();
   mRemovedDirs.clear();
 }
@@ -309,13 +328,20 @@ QStringList TransactionalFileSystem::checkForModifications() const {
     }
   }
 
-  // new or modified files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FilePath fp = mFilePath.getPathTo(filepath);
-    QByteArray content = mModifiedFiles.value(filepath);
-    if ((!fp.isExistingFile()) ||
-        (FileUtils::readFile(fp) != content)) {  // can throw
-      modifications.append(filepath);
+  // new or modified files, compared in worker threads since reading many
+  // files one after another is slow for large projects and libraries
+  QList<QPair<QString, QFuture<bool>>> jobs;
+  for (auto it = mModifiedFiles.constBegin(); it != mModifiedFiles.constEnd();
+       ++it) {
+    FilePath fp = mFilePath.getPathTo(it.key());
+    QByteArray content = it.value();
+    jobs.append(qMakePair(it.key(), QtConcurrent::run([fp, content]() {
+                            return isFileModified(fp, content);  // can throw
+                          })));
+  }
+  for (int i = 0; i < jobs.count(); ++i) {
+    if (jobs.at(i).second.result()) {  // can throw
+      modifications.append(jobs.at(i).first);
     }
   }
 
@@ -365,6 +391,7 @@ void TransactionalFileSystem::save() {
 
   // clear state
   discardChanges();
+  mDiskCache.clear();  // the disk content has been modified
 }
 
 /*******************************************************************************
@@ -383,13 +410,96 @@ QString TransactionalFileSystem::cleanPath(QString path) noexcept {
  *  Private Methods
  ******************************************************************************/
 
+bool TransactionalFileSystem::isFileModified(const FilePath& fp,
+                                             const QByteArray& content) {
+  QFileInfo info(fp.toStr());
+  if ((!info.isFile()) || (info.size() != content.size())) {
+    return true;  // no need to read the file
+  }
+  return FileUtils::readFile(fp) != content;  // can throw
+}
+
+TransactionalFileSystem::DiskDir TransactionalFileSystem::getDiskDir(
+    const QString& dirpath) const noexcept {
+  if (mDiskCacheEnabled) {
+    auto it = mDiskCache.constFind(dirpath);
+    if (it != mDiskCache.constEnd()) {
+      return *it;
+    }
+  }
+
+  DiskDir content;
+  QDir dir(mFilePath.getPathTo(dirpath).toStr());
+  foreach (const QFileInfo& info,
+           dir.entryInfoList(QDir::Dirs | QDir::Files | QDir::Hidden |
+                             QDir::NoDotAndDotDot)) {
+    if (info.isDir()) {
+      content.dirs.append(info.fileName());
+    } else {
+      content.files.append(info.fileName());
+    }
+  }
+  if (mDiskCacheEnabled) {
+    mDiskCache.insert(dirpath, content);
+  }
+  return content;
+}
+
+void TransactionalFileSystem::insertModifiedFile(
+    const QString& path, const QByteArray& content) noexcept {
+  if (!mModifiedFiles.contains(path)) {
+    QStringList parts = path.split('/');
+    QString dirpath;
+    for (int i = 0; i < parts.count() - 1; ++i) {
+      mModifiedDirs[dirpath].dirs[parts.at(i)]++;
+      dirpath += parts.at(i) % "/";
+    }
+    mModifiedDirs[dirpath].files.insert(parts.last());
+  }
+  mModifiedFiles.insert(path, content);
+}
+
+void TransactionalFileSystem::removeModifiedFile(const QString& path) noexcept {
+  if (mModifiedFiles.remove(path) == 0) {
+    return;
+  }
+  QStringList parts = path.split('/');
+  QString dirpath;
+  for (int i = 0; i < parts.count(); ++i) {
+    auto it = mModifiedDirs.find(dirpath);
+    Q_ASSERT(it != mModifiedDirs.end());
+    if (i < parts.count() - 1) {
+      if (--it->dirs[parts.at(i)] <= 0) {
+        it->dirs.remove(parts.at(i));
+      }
+    } else {
+      it->files.remove(parts.at(i));
+    }
+    if (it->dirs.isEmpty() && it->files.isEmpty()) {
+      mModifiedDirs.erase(it);
+    }
+    dirpath += parts.at(i) % "/";
+  }
+}
+
+void TransactionalFileSystem::clearModifiedFiles() noexcept {
+  mModifiedFiles.clear();
+  mModifiedDirs.clear();
+}
+
 bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
   if (mRemovedFiles.contains(path)) {
     return true;
   }
 
-  foreach (const QString dir, mRemovedDirs) {
-    if (path.startsWith(dir)) {
+  // check if the path or any of its parent directories was removed
+  if (mRemovedDirs.isEmpty()) {
+    return false;
+  } else if (mRemovedDirs.contains(QString(""))) {
+    return true;
+  }
+  for (int i = path.indexOf('/'); i >= 0; i = path.indexOf('/', i + 1)) {
+    if (mRemovedDirs.contains(path.left(i + 1))) {
       return true;
     }
   }
@@ -479,7 +589,7 @@ void TransactionalFileSystem::loadDiff(const FilePath& fp) {
   foreach (const SExpression& node, root.getChildren("modified_file")) {
     QString relPath = node.getChild("@0").getValue();
     FilePath absPath = modifiedFilesDir.getPathTo(relPath);
-    mModifiedFiles.insert(relPath, FileUtils::readFile(absPath));  // can throw
+    insertModifiedFile(relPath, FileUtils::readFile(absPath));  // can throw
   }
   foreach (const SExpression& node, root.getChildren("removed_file")) {
     QString relPath = node.getChild("@0").getValue();
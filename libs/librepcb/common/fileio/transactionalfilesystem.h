@@ -137,6 +137,22 @@ public:
   const FilePath& getPath() const noexcept { return mFilePath; }
   bool isWritable() const noexcept { return mIsWritable; }
   bool isRestoredFromAutosave() const noexcept { return mRestoredFromAutosave; }
+  bool isDiskCacheEnabled() const noexcept { return mDiskCacheEnabled; }
+
+  // Setters
+
+  /**
+   * @brief Enable or disable caching of directory listings from the disk
+   *
+   * If enabled, the content of each directory is read from the disk only
+   * once, following calls to #getDirs() and #getFiles() are served from
+   * memory. Only useful if the directory is not modified on the disk by
+   * anyone else while this file system is open. The cache is cleared by
+   * #save().
+   *
+   * @param enabled   Whether the cache is enabled or not (default: disabled).
+   */
+  void setDiskCacheEnabled(bool enabled) noexcept;
 
   // Inherited from FileSystem
   virtual FilePath getAbsPath(const QString& path = "") const noexcept override;
@@ -181,13 +197,36 @@ public:
   }
   static QString cleanPath(QString path) noexcept;
 
+private:  // Types
+  /**
+   * @brief Node of the directory tree built from #mModifiedFiles
+   */
+  struct ModifiedDir {
+    QHash<QString, int> dirs;  ///< Subdirectory name -> number of files
+    QSet<QString> files;  ///< File names
+  };
+
+  /**
+   * @brief Cached content of a directory on the disk
+   */
+  struct DiskDir {
+    QStringList dirs;
+    QStringList files;
+  };
+
 private:  // Methods
+  DiskDir getDiskDir(const QString& dirpath) const noexcept;
+  void insertModifiedFile(const QString& path,
+                          const QByteArray& content) noexcept;
+  void removeModifiedFile(const QString& path) noexcept;
+  void clearModifiedFiles() noexcept;
   bool isRemoved(const QString& path) const noexcept;
   void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
                       const QString& dir) const;
   void saveDiff(const QString& type) const;
   void loadDiff(const FilePath& fp);
   void removeDiff(const QString& type);
+  static bool isFileModified(const FilePath& fp, const QByteArray& content);
 
 private:  // Data
   FilePath mFilePath;
@@ -199,6 +238,14 @@ private:  // Data
   QHash<QString, QByteArray> mModifiedFiles;
   QSet<QString> mRemovedFiles;
   QSet<QString> mRemovedDirs;
+
+  /// Index of #mModifiedFiles for fast directory listings (key: directory
+  /// path with trailing slash, or empty for the root directory)
+  QHash<QString, ModifiedDir> mModifiedDirs;
+
+  // Cached directory listings from the disk
+  bool mDiskCacheEnabled;
+  mutable QHash<QString, DiskDir> mDiskCache;  ///< Same keys as mModifiedDirs
 };
 
 /*******************************************************************************
@@ -41,16 +41,12 @@ namespace fb = fontobene;
 
 StrokeFont::StrokeFont(const FilePath& fontFilePath,
                        const QByteArray& content) noexcept
-  : QObject(nullptr), mFilePath(fontFilePath) {
-  // load the font in another thread because it takes some time to load it
-  qDebug() << "Start loading font" << mFilePath.toNative();
-  mFuture = QtConcurrent::run([content]() {
-    QTextStream s(content);
-    return fb::Font(s);
-  });
+  : QObject(nullptr),
+    mFilePath(fontFilePath),
+    mContent(content),
+    mLoadingStarted(false) {
   connect(&mWatcher, &QFutureWatcher<fb::Font>::finished, this,
           &StrokeFont::fontLoaded);
-  mWatcher.setFuture(mFuture);
 }
 
 StrokeFont::~StrokeFont() noexcept {
@@ -74,14 +70,47 @@ Ratio StrokeFont::getLineSpacing() const noexcept {
  *  General Methods
  ******************************************************************************/
 
+void StrokeFont::loadInBackground() const noexcept {
+  QMutexLocker locker(&mLoadMutex);
+  if (mFont || mLoadingStarted) {
+    return;
+  }
+
+  // load the font in another thread because it takes some time to load it
+  qDebug() << "Start loading font" << mFilePath.toNative();
+  const QByteArray content = mContent;
+  mFuture = QtConcurrent::run([content]() {
+    QTextStream s(content);
+    return fb::Font(s);
+  });
+  mWatcher.setFuture(mFuture);
+  mLoadingStarted = true;
+}
+
 QVector<Path> StrokeFont::stroke(const QString& text,
                                  const PositiveLength& height,
                                  const Length& letterSpacing,
                                  const Length& lineSpacing,
                                  const Alignment& align, Point& bottomLeft,
                                  Point& topRight) const noexcept {
-  accessor();  // block until the font is loaded. TODO: abort instead of
-               // waiting?
+  // Block until the font is loaded since the caller needs the paths now.
+  // Usually this returns immediately or waits only a short time because
+  // StrokeFontPool::getFont() already started loading the font.
+  accessor();
+
+  // Reuse the layout of identical texts (e.g. lots of equal designators)
+  const LayoutKey key{text, height->toNm(), letterSpacing.toNm(),
+                      lineSpacing.toNm(), align.toQtAlign()};
+  {
+    QMutexLocker locker(&mCacheMutex);
+    auto it = mLayoutCache.constFind(key);
+    if (it != mLayoutCache.constEnd()) {
+      bottomLeft = it->bottomLeft;
+      topRight = it->topRight;
+      return it->paths;
+    }
+  }
+
   QVector<Path> paths;
   Length totalWidth;
   QVector<QPair<QVector<Path>, Length>> lines =
@@ -130,6 +159,11 @@ QVector<Path> StrokeFont::stroke(const QString& text,
     topRight.setY(totalHeight / 2);
   }
 
+  QMutexLocker locker(&mCacheMutex);
+  if (mLayoutCache.count() >= 10000) {
+    mLayoutCache.clear();  // limit memory usage
+  }
+  mLayoutCache.insert(key, Layout{paths, bottomLeft, topRight});
   return paths;
 }
 
@@ -154,22 +188,19 @@ QVector<Path> StrokeFont::strokeLine(const QString& text,
   Length offset = 0;
   width = 0;  // same as offset, but without last letter spacing
   for (int i = 0; i < text.length(); ++i) {
-    Length glyphSpacing;
-    QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-    if (!glyphPaths.isEmpty()) {
-      Point bottomLeft, topRight;
-      computeBoundingRect(glyphPaths, bottomLeft, topRight);
-      Length shift =
-          (i == 0) ? -bottomLeft.getX() : 0;  // left-align first character
-      foreach (const Path& p, glyphPaths) {
+    const Glyph glyph = getGlyph(text.at(i), height);
+    if (!glyph.paths.isEmpty()) {
+      Length shift = (i == 0) ? -glyph.bottomLeft.getX()
+                              : 0;  // left-align first character
+      foreach (const Path& p, glyph.paths) {
         paths.append(p.translated(Point(offset + shift, Length(0))));
       }
-      width = offset + topRight.getX() +
+      width = offset + glyph.topRight.getX() +
           shift;  // do *not* count glyph spacing as width!
-      offset = width + glyphSpacing + letterSpacing;
-    } else if (glyphSpacing != 0) {
+      offset = width + glyph.spacing + letterSpacing;
+    } else if (glyph.spacing != 0) {
       // it's a whitespace-only glyph -> count additional glyph spacing as width
-      width = offset + glyphSpacing;
+      width = offset + glyph.spacing;
       offset = width + letterSpacing;
     }
   }
@@ -179,32 +210,59 @@ QVector<Path> StrokeFont::strokeLine(const QString& text,
 QVector<Path> StrokeFont::strokeGlyph(const QChar& glyph,
                                       const PositiveLength& height,
                                       Length& spacing) const noexcept {
+  const Glyph g = getGlyph(glyph, height);
+  spacing = g.spacing;
+  return g.paths;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+StrokeFont::Glyph StrokeFont::getGlyph(const QChar& glyph,
+                                      const PositiveLength& height) const
+    noexcept {
+  QMutexLocker locker(&mCacheMutex);
+  const QPair<ushort, LengthBase_t> key(glyph.unicode(), height->toNm());
+  auto it = mGlyphCache.constFind(key);
+  if (it != mGlyphCache.constEnd()) {
+    return *it;
+  }
+
+  Glyph result;
   try {
     qreal glyphSpacing = 0;
     QVector<fb::Polyline> polylines =
         accessor().getAllPolylinesOfGlyph(glyph.unicode(),
                                           &glyphSpacing);  // can throw
-    spacing = convertLength(height, glyphSpacing);
-    return polylines2paths(polylines, height);
+    result.spacing = convertLength(height, glyphSpacing);
+    result.paths = polylines2paths(polylines, height);
+    if (!result.paths.isEmpty()) {
+      computeBoundingRect(result.paths, result.bottomLeft, result.topRight);
+    }
   } catch (const fb::Exception& e) {
     qWarning() << "Failed to load stroke font glyph" << glyph;
-    spacing = 0;
-    return QVector<Path>();
   }
+  mGlyphCache.insert(key, result);
+  return result;
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
 void StrokeFont::fontLoaded() noexcept {
   accessor();  // trigger the message about loading succeeded or failed
 }
 
 const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
+  QMutexLocker locker(&mLoadMutex);
   if (!mFont) {
     try {
-      mFont.reset(new fb::Font(mFuture.result()));  // can throw
+      if (mLoadingStarted) {
+        mFont.reset(new fb::Font(mFuture.result()));  // can throw
+      } else {
+        // not loaded in background -> load it now in the calling thread
+        qDebug() << "Load font" << mFilePath.toNative();
+        QTextStream s(mContent);
+        mFont.reset(new fb::Font(s));  // can throw
+      }
       qDebug() << "Successfully loaded font" << mFilePath.toNative() << "with"
                << mFont->glyphs.count() << "glyphs";
     } catch (const fb::Exception& e) {
@@ -222,6 +280,7 @@ const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
         {0x2126, 0x03A9});  // OHM SIGN <-> GREEK CAPITAL LETTER OMEGA
 
     mGlyphListAccessor.reset(new fb::GlyphListAccessor(*mGlyphListCache));
+    mContent.clear();  // not needed anymore
   }
   return *mGlyphListAccessor;
 }
@@ -48,6 +48,10 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * The font file is parsed lazily, i.e. not before the font is used the first
+ * time (or #loadInBackground() is called, which StrokeFontPool::getFont()
+ * does), so fonts which are not used at all do not consume any CPU time.
  */
 class StrokeFont final : public QObject {
   Q_OBJECT
@@ -63,6 +67,16 @@ public:
   Ratio getLineSpacing() const noexcept;
 
   // General Methods
+
+  /**
+   * @brief Start parsing the font file in a worker thread
+   *
+   * Useful to avoid blocking the first #stroke() call for fonts which are
+   * known to be needed soon. Does nothing if the font is already loaded or
+   * if loading was already started.
+   */
+  void loadInBackground() const noexcept;
+
   QVector<Path> stroke(const QString& text, const PositiveLength& height,
                        const Length& letterSpacing, const Length& lineSpacing,
                        const Alignment& align, Point& bottomLeft,
@@ -79,7 +93,53 @@ public:
   // Operator Overloadings
   StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
+private:  // Types
+  /**
+   * @brief A stroked glyph of a specific height
+   */
+  struct Glyph {
+    QVector<Path> paths;
+    Length spacing;
+    Point bottomLeft;
+    Point topRight;
+  };
+
+  /**
+   * @brief All parameters which influence the result of #stroke()
+   */
+  struct LayoutKey {
+    QString text;
+    LengthBase_t height;
+    LengthBase_t letterSpacing;
+    LengthBase_t lineSpacing;
+    Qt::Alignment align;
+
+    bool operator==(const LayoutKey& rhs) const noexcept {
+      return (text == rhs.text) && (height == rhs.height) &&
+          (letterSpacing == rhs.letterSpacing) &&
+          (lineSpacing == rhs.lineSpacing) && (align == rhs.align);
+    }
+    friend uint qHash(const LayoutKey& key, uint seed = 0) noexcept {
+      seed = ::qHash(key.text, seed);
+      seed = ::qHash(key.height, seed);
+      seed = ::qHash(key.letterSpacing, seed);
+      seed = ::qHash(key.lineSpacing, seed);
+      return ::qHash(static_cast<int>(key.align), seed);
+    }
+  };
+
+  /**
+   * @brief The result of #stroke()
+   */
+  struct Layout {
+    QVector<Path> paths;
+    Point bottomLeft;
+    Point topRight;
+  };
+
 private:
+  Glyph getGlyph(const QChar& glyph, const PositiveLength& height) const
+      noexcept;
   void fontLoaded() noexcept;
   const fontobene::GlyphListAccessor& accessor() const noexcept;
   static QVector<Path> polylines2paths(
@@ -96,11 +156,19 @@ private:
 
 private:  // Data
   FilePath mFilePath;
-  QFuture<fontobene::Font> mFuture;
-  QFutureWatcher<fontobene::Font> mWatcher;
+  mutable QByteArray mContent;  ///< Released as soon as the font is loaded
+  mutable bool mLoadingStarted;
+  mutable QFuture<fontobene::Font> mFuture;
+  mutable QFutureWatcher<fontobene::Font> mWatcher;
+  mutable QMutex mLoadMutex;  ///< Protects loading the font on demand
   mutable QScopedPointer<fontobene::Font> mFont;
   mutable QScopedPointer<fontobene::GlyphListCache> mGlyphListCache;
   mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+
+  // Caches to avoid stroking the same glyphs and texts again and again
+  mutable QMutex mCacheMutex;
+  mutable QHash<QPair<ushort, LengthBase_t>, Glyph> mGlyphCache;
+  mutable QHash<LayoutKey, Layout> mLayoutCache;
 };
 
 /*******************************************************************************
@@ -60,8 +60,12 @@ StrokeFontPool::~StrokeFontPool() noexcept {
  ******************************************************************************/
 
 const StrokeFont& StrokeFontPool::getFont(const QString& filename) const {
-  if (mFonts.contains(filename)) {
-    return *mFonts[filename];
+  auto it = mFonts.constFind(filename);
+  if (it != mFonts.constEnd()) {
+    // Start parsing the font file now, so it is probably (partially) done
+    // when the first text gets stroked.
+    (*it)->loadInBackground();
+    return **it;
   } else {
     throw RuntimeError(
         __FILE__, __LINE__,
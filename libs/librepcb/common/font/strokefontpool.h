@@ -53,6 +53,19 @@ public:
   ~StrokeFontPool() noexcept;
 
   // Getters
+
+  /**
+   * @brief Get a font of the pool
+   *
+   * If the font was not requested before, parsing its file is started in a
+   * worker thread (see StrokeFont::loadInBackground()).
+   *
+   * @param filename  The font's filename, e.g. "newstroke.bene"
+   *
+   * @return The requested font
+   *
+   * @throw Exception if the pool does not contain the requested font
+   */
   const StrokeFont& getFont(const QString& filename) const;
 
   // Operator Overloadings
@@ -56,6 +56,16 @@ CmdPolygonEdit::~CmdPolygonEdit() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdPolygonEdit::getApproximateMemoryUsage() const noexcept {
+  return UndoCommand::getApproximateMemoryUsage() +
+      (mOldPath.getVertices().capacity() + mNewPath.getVertices().capacity()) *
+      sizeof(Vertex);
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
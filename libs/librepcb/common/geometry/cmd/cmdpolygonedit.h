@@ -48,6 +48,9 @@ public:
   explicit CmdPolygonEdit(Polygon& polygon) noexcept;
   ~CmdPolygonEdit() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
   // Setters
   void setLayerName(const GraphicsLayerName& name, bool immediate) noexcept;
   void setLineWidth(const UnsignedLength& width, bool immediate) noexcept;
@@ -49,9 +49,15 @@ GraphicsView::GraphicsView(QWidget* parent,
     mSceneRectMarker(),
     mOriginCrossVisible(true),
     mUseOpenGl(false),
-    mPanningActive(false) {
+    mUsePartialViewportUpdates(false),
+    mPanningActive(false),
+    mMeasureFrameTimes(qgetenv("LIBREPCB_PRINT_FRAME_TIMES") == "1"),
+    mFrameTimesName(),
+    mFrameTimesHistogram(),
+    mFrameTimesTotalNs(0) {
   setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
   setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+  setCacheMode(QGraphicsView::CacheNone);
   setOptimizationFlags(QGraphicsView::DontSavePainterState);
   setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
   setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
@@ -66,6 +72,9 @@ GraphicsView::GraphicsView(QWidget* parent,
 }
 
 GraphicsView::~GraphicsView() noexcept {
+  if (mMeasureFrameTimes) {
+    printFrameTimeStatistics();
+  }
   delete mZoomAnimation;
   mZoomAnimation = nullptr;
   delete mGridProperties;
@@ -110,9 +119,21 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept {
   viewport()->grabGesture(Qt::PinchGesture);
 }
 
+void GraphicsView::setUsePartialViewportUpdates(bool partial) noexcept {
+  if (partial) {
+    setViewportUpdateMode(QGraphicsView::BoundingRectViewportUpdate);
+    setCacheMode(QGraphicsView::CacheBackground);
+  } else {
+    setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    setCacheMode(QGraphicsView::CacheNone);
+  }
+  mUsePartialViewportUpdates = partial;
+}
+
 void GraphicsView::setGridProperties(
     const GridProperties& properties) noexcept {
   *mGridProperties = properties;
+  resetCachedContent();  // the cached background contains the grid
   setBackgroundBrush(backgroundBrush());  // this will repaint the background
 }
 
@@ -231,6 +252,43 @@ void GraphicsView::zoomAnimationValueChanged(const QVariant& value) noexcept {
  *  Inherited from QGraphicsView
  ******************************************************************************/
 
+void GraphicsView::paintEvent(QPaintEvent* event) {
+  if (!mMeasureFrameTimes) {
+    QGraphicsView::paintEvent(event);
+    return;
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+  QGraphicsView::paintEvent(event);
+  qint64 elapsedNs = timer.nsecsElapsed();
+
+  // Bucket i contains all frames which took less than 2^i milliseconds, the
+  // last bucket contains all slower frames.
+  if (mFrameTimesHistogram.isEmpty()) {
+    mFrameTimesName = window()->metaObject()->className();
+    mFrameTimesHistogram.fill(0, 9);
+  }
+  int bucket = 0;
+  while ((bucket < mFrameTimesHistogram.count() - 1) &&
+         (elapsedNs >= (qint64(1000000) << bucket))) {
+    ++bucket;
+  }
+  mFrameTimesHistogram[bucket]++;
+  mFrameTimesTotalNs += elapsedNs;
+}
+
+void GraphicsView::scrollContentsBy(int dx, int dy) {
+  QGraphicsView::scrollContentsBy(dx, dy);
+
+  // With partial viewport updates, Qt just scrolls the already painted
+  // content. But the scene rect marker line starts at the top left of the
+  // view, so it needs to be repainted completely.
+  if (mUsePartialViewportUpdates && (!mSceneRectMarker.isEmpty())) {
+    viewport()->update();
+  }
+}
+
 // In Qt<5.5, do not specially handle trackpad events.
 // It is not possible to process the wheel event in the `eventFilter` because
 // `QGraphicsSceneWheelEvent` does not track the source of the wheel event.
@@ -337,13 +395,55 @@ void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect) {
   painter->setBrush(backgroundBrush());
   painter->fillRect(rect, backgroundBrush());
 
+  // Drawing every single grid line or dot is very slow for fine grids and
+  // large views, thus the grid is drawn with a cached pixmap containing one or
+  // more grid cells, tiled 1:1 onto the device pixels. Since the tile has an
+  // integer size, it is only used if it contains (almost) exactly an integer
+  // number of cells. Otherwise lines and dots would drop out, double or drift
+  // away from their actual position, so the grid is drawn directly instead.
+  qreal gridIntervalPixels = mGridProperties->getInterval()->toPx();
+  qreal scaleFactor = transform().m11();  // rect might be only a part of view
+  if (gridIntervalPixels * scaleFactor >= (qreal)5) {
+    int dpr = viewport()->devicePixelRatio();
+    qreal cellSize = gridIntervalPixels * scaleFactor * dpr;  // device pixels
+    int viewSize = qMax(viewport()->width(), viewport()->height()) * dpr;
+    int cells = getGridTileCellCount(cellSize, viewSize);
+    QPixmap tile = (cells > 0) ? getGridTile(mGridProperties->getType(),
+                                             cellSize, cells, gridPen.color(),
+                                             dpr)
+                               : QPixmap();
+    if (!tile.isNull()) {
+      // Anchor the tiles at a grid point at the top left of the viewport (not
+      // at the scene origin) to keep the accumulated rounding error small.
+      // Note: The painter might draw into the background cache, so use its
+      // transformation instead of the view's one.
+      QTransform sceneToView = painter->transform();
+      qreal tileInterval = gridIntervalPixels * cells;  // scene pixels
+      QPointF topLeft = sceneToView.inverted().map(QPointF(0, 0));
+      QPointF anchor = sceneToView.map(
+          QPointF(qFloor(topLeft.x() / tileInterval) * tileInterval,
+                  qFloor(topLeft.y() / tileInterval) * tileInterval));
+      QRectF viewRect = sceneToView.mapRect(rect);
+      qreal tileSize = tile.width() / (qreal)dpr;  // device independent pixels
+      auto offset = [tileSize](qreal value) -> qreal {
+        qreal result = std::fmod(value, tileSize);
+        return (result < 0) ? (result + tileSize) : result;
+      };
+      painter->save();
+      painter->resetTransform();
+      painter->drawTiledPixmap(viewRect, tile,
+                               QPointF(offset(viewRect.left() - anchor.x()),
+                                       offset(viewRect.top() - anchor.y())));
+      painter->restore();
+      return;
+    }
+  }
+
   // draw background grid lines
   gridPen.setWidth(
       (mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
   painter->setPen(gridPen);
   painter->setBrush(Qt::NoBrush);
-  qreal gridIntervalPixels = mGridProperties->getInterval()->toPx();
-  qreal scaleFactor = width() / rect.width();
   if (gridIntervalPixels * scaleFactor >= (qreal)5) {
     qreal left, right, top, bottom;
     left = qFloor(rect.left() / gridIntervalPixels) * gridIntervalPixels;
@@ -399,6 +499,103 @@ void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect) {
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+int GraphicsView::getGridTileCellCount(qreal cellSize, int viewSize) noexcept {
+  // Within the view, the rounding error of the tile size must not sum up to
+  // more than half a pixel, i.e. the grid may be off by at most one pixel.
+  for (int cells = 1; cells * cellSize <= sMaxGridTileSize; ++cells) {
+    qreal tileSize = cells * cellSize;
+    qreal error = qAbs(tileSize - qRound(tileSize));
+    if (error * (viewSize / tileSize + 1) < 0.5) {
+      return cells;
+    }
+  }
+  return 0;  // no suitable tile size found
+}
+
+QPixmap GraphicsView::getGridTile(GridProperties::Type_t type, qreal cellSize,
+                                  int cells, const QColor& color,
+                                  int devicePixelRatio) noexcept {
+  // The tiles are stored in the global pixmap cache, so they are shared
+  // between all views and are regenerated only if any parameter has changed.
+  QString key = QString("librepcb_grid_tile_%1_%2_%3_%4_%5")
+                    .arg(static_cast<int>(type))
+                    .arg(cellSize, 0, 'g', 10)
+                    .arg(cells)
+                    .arg(color.rgba(), 0, 16)
+                    .arg(devicePixelRatio);
+  QPixmap tile;
+  if (QPixmapCache::find(key, &tile)) {
+    return tile;
+  }
+
+  // Each grid point is rounded to the nearest device pixel. The first grid
+  // point is located at the top left corner of the tile. To get the same
+  // result as when drawing the grid directly, dots are drawn as squares of two
+  // pixels (scaled by the device pixel ratio) centered on each point, i.e.
+  // dots on the tile borders are spread over the opposite borders too.
+  int size = qRound(cells * cellSize);
+  int width = devicePixelRatio;  // line width and half dot size
+  QVector<int> positions;
+  for (int i = 0; i < cells; ++i) {
+    positions.append(qRound(i * cellSize));
+  }
+  tile = QPixmap(size, size);
+  tile.fill(Qt::transparent);
+  QPainter painter(&tile);
+  painter.setCompositionMode(QPainter::CompositionMode_Source);  // no overlap
+  switch (type) {
+    case GridProperties::Type_t::Lines: {
+      QColor lineColor = color;
+      lineColor.setAlphaF(color.alphaF() * 0.5);
+      foreach (int pos, positions) {
+        painter.fillRect(QRect(pos, 0, width, size), lineColor);
+        painter.fillRect(QRect(0, pos, size, width), lineColor);
+      }
+      break;
+    }
+
+    case GridProperties::Type_t::Dots: {
+      positions.append(size);  // wrapped around dots of the first row/column
+      foreach (int x, positions) {
+        foreach (int y, positions) {
+          painter.fillRect(QRect(x - width, y - width, 2 * width, 2 * width),
+                           color);
+        }
+      }
+      break;
+    }
+
+    default:
+      return QPixmap();
+  }
+  painter.end();
+  tile.setDevicePixelRatio(devicePixelRatio);
+
+  QPixmapCache::insert(key, tile);
+  return tile;
+}
+
+void GraphicsView::printFrameTimeStatistics() const noexcept {
+  int frames = 0;
+  foreach (int count, mFrameTimesHistogram) { frames += count; }
+  if (frames == 0) {
+    return;
+  }
+  qInfo("Frame times of %s: %d frames, average %lld us",
+        qPrintable(mFrameTimesName), frames,
+        (mFrameTimesTotalNs / frames) / 1000);
+  for (int i = 0; i < mFrameTimesHistogram.count(); ++i) {
+    QString range = (i < mFrameTimesHistogram.count() - 1)
+        ? QString("< %1 ms").arg(1 << i)
+        : QString(">= %1 ms").arg(1 << (i - 1));
+    qInfo("  %9s: %d", qPrintable(range), mFrameTimesHistogram.at(i));
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
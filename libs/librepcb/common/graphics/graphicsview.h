@@ -23,6 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../gridproperties.h"
 #include "../units/all_length_units.h"
 
 #include <QtCore>
@@ -35,7 +36,6 @@ namespace librepcb {
 
 class IF_GraphicsViewEventHandler;
 class GraphicsScene;
-class GridProperties;
 
 /*******************************************************************************
  *  Class GraphicsView
@@ -43,6 +43,12 @@ class GridProperties;
 
 /**
  * @brief The GraphicsView class
+ *
+ * If the environment variable `LIBREPCB_PRINT_FRAME_TIMES` is set to "1", the
+ * time needed to paint each frame is measured and a histogram of the frame
+ * times is printed when the view is destroyed. This allows to measure the
+ * rendering performance of large boards and schematics (e.g. with the
+ * "offscreen" platform or in a virtual X server).
  */
 class GraphicsView final : public QGraphicsView {
   Q_OBJECT
@@ -58,12 +64,28 @@ public:
   GraphicsScene* getScene() const noexcept { return mScene; }
   QRectF getVisibleSceneRect() const noexcept;
   bool getUseOpenGl() const noexcept { return mUseOpenGl; }
+  bool getUsePartialViewportUpdates() const noexcept {
+    return mUsePartialViewportUpdates;
+  }
   const GridProperties& getGridProperties() const noexcept {
     return *mGridProperties;
   }
 
   // Setters
   void setUseOpenGl(bool useOpenGl) noexcept;
+
+  /**
+   * @brief Enable or disable partial viewport updates
+   *
+   * By default, the whole viewport is repainted on every change. With partial
+   * viewport updates, only the bounding rect of the changed region is
+   * repainted and the background (grid) is cached in a pixmap. This is a lot
+   * faster for large scenes, but graphics items which paint outside of their
+   * bounding rect might leave some artifacts.
+   *
+   * @param partial   Whether partial viewport updates should be used or not.
+   */
+  void setUsePartialViewportUpdates(bool partial) noexcept;
   void setGridProperties(const GridProperties& properties) noexcept;
   void setScene(GraphicsScene* scene) noexcept;
   void setVisibleSceneRect(const QRectF& rect) noexcept;
@@ -114,11 +136,20 @@ private:
   GraphicsView& operator=(const GraphicsView& rhs) = delete;
 
   // Inherited Methods
+  void paintEvent(QPaintEvent* event);
+  void scrollContentsBy(int dx, int dy);
   void wheelEvent(QWheelEvent* event);
   bool eventFilter(QObject* obj, QEvent* event);
   void drawBackground(QPainter* painter, const QRectF& rect);
   void drawForeground(QPainter* painter, const QRectF& rect);
 
+  // Private Methods
+  static int getGridTileCellCount(qreal cellSize, int viewSize) noexcept;
+  static QPixmap getGridTile(GridProperties::Type_t type, qreal cellSize,
+                             int cells, const QColor& color,
+                             int devicePixelRatio) noexcept;
+  void printFrameTimeStatistics() const noexcept;
+
   // General Attributes
   IF_GraphicsViewEventHandler* mEventHandlerObject;
   GraphicsScene* mScene;
@@ -127,11 +158,19 @@ private:
   QRectF mSceneRectMarker;
   bool mOriginCrossVisible;
   bool mUseOpenGl;
+  bool mUsePartialViewportUpdates;
   volatile bool mPanningActive;
   QCursor mCursorBeforePanning;
 
+  // Frame Time Statistics
+  bool mMeasureFrameTimes;  ///< Whether frame times are measured or not
+  QString mFrameTimesName;  ///< Name of the editor, used for the output
+  QVector<int> mFrameTimesHistogram;  ///< Frame count per bucket
+  qint64 mFrameTimesTotalNs;  ///< Sum of all frame times
+
   // Static Variables
   static constexpr qreal sZoomStepFactor = 1.3;
+  static constexpr int sMaxGridTileSize = 512;  ///< In device pixels
 };
 
 /*******************************************************************************
@@ -93,6 +93,31 @@ public:
     return copy;
   }
 
+  /**
+   * @brief Remove all items from a list which are not contained in an index
+   *
+   * The order of the remaining items is preserved. This takes only a single
+   * pass over the list, so it is much faster than removing the items one by
+   * one if many of them have to be removed.
+   *
+   * @param list    The list to remove the items from.
+   * @param index   The index of all items to keep. An item of the list is
+   *                only kept if it is stored in the index under the key
+   *                returned by its getUuid() method.
+   */
+  template <typename K, typename T>
+  static void removeUnindexedItems(QList<T*>& list,
+                                   const QHash<K, T*>& index) noexcept {
+    QList<T*> items;
+    items.reserve(index.count());
+    foreach (T* item, list) {
+      if (index.value(item->getUuid()) == item) {
+        items.append(item);
+      }
+    }
+    list = items;
+  }
+
   static QRectF boundingRectFromRadius(qreal radius) noexcept {
     return QRectF(-radius, -radius, 2 * radius, 2 * radius);
   }
@@ -75,6 +75,18 @@ public:
    */
   bool isCurrentlyExecuted() const noexcept { return mRedoCount > mUndoCount; }
 
+  /**
+   * @brief Get the approximate amount of memory used by this command
+   *
+   * This is used by librepcb::UndoStack to limit the memory consumption of
+   * the undo history. Derived classes which hold a lot of data (e.g. copies
+   * of paths) should override this method and add their own data to the
+   * value returned by the base class.
+   *
+   * @return Approximate memory usage in bytes
+   */
+  virtual qint64 getApproximateMemoryUsage() const noexcept;
+
   // General Methods
 
   /**
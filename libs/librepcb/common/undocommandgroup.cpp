@@ -46,6 +46,18 @@ UndoCommandGroup::~UndoCommandGroup() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommandGroup::getApproximateMemoryUsage() const noexcept {
+  qint64 usage = UndoCommand::getApproximateMemoryUsage();
+  foreach (const UndoCommand* cmd, mChilds) {
+    usage += cmd->getApproximateMemoryUsage();
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
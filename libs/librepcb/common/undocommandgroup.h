@@ -52,6 +52,7 @@ public:
 
   // Getters
   int getChildCount() const noexcept { return mChilds.count(); }
+  virtual qint64 getApproximateMemoryUsage() const noexcept override;
 
   // General Methods
 
@@ -75,6 +75,11 @@ void UndoStackTransaction::commit() {
 
 UndoStack::UndoStack() noexcept
   : QObject(nullptr),
+    mCommands(),
+    mCommandMemoryUsages(),
+    mMemoryUsage(0),
+    mMaxCommandCount(1000),
+    mMaxMemoryUsage(qint64(256) * 1024 * 1024),
     mCurrentIndex(0),
     mCleanIndex(0),
     mActiveCommandGroup(nullptr) {
@@ -130,6 +135,16 @@ void UndoStack::setClean() noexcept {
   emit cleanChanged(true);
 }
 
+void UndoStack::setMaxCommandCount(int count) noexcept {
+  mMaxCommandCount = qMax(count, 0);
+  discardOldestCommands();
+}
+
+void UndoStack::setMaxMemoryUsage(qint64 bytes) noexcept {
+  mMaxMemoryUsage = qMax(bytes, qint64(0));
+  discardOldestCommands();
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -158,15 +173,18 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     // impossible)
     // --> in reverse order (from top to bottom)!
     while (mCurrentIndex < mCommands.count()) {
-      delete mCommands.takeLast();
+      deleteLastCommand();
     }
     Q_ASSERT(mCurrentIndex == mCommands.count());
 
     // add command to the command stack
-    mCommands.append(
+    appendCommand(
         cmdScopeGuard.take());  // move ownership of "cmd" to "mCommands"
     mCurrentIndex++;
 
+    // limit the size of the stack
+    discardOldestCommands();
+
     // emit signals
     emit undoTextChanged(tr("Undo: %1").arg(cmd->getText()));
     emit redoTextChanged(tr("Redo"));
@@ -234,8 +252,16 @@ bool UndoStack::commitCmdGroup() {
 
   // To finish the active command group, we only need to reset the pointer to
   // the currently active command group
+  Q_ASSERT(mCommands.last() == mActiveCommandGroup);
+  mMemoryUsage -= mCommandMemoryUsages.last();
+  mCommandMemoryUsages.last() =
+      mActiveCommandGroup->getApproximateMemoryUsage();
+  mMemoryUsage += mCommandMemoryUsages.last();
   mActiveCommandGroup = nullptr;
 
+  // the group might be large, so limit the size of the stack again
+  discardOldestCommands();
+
   // emit signals
   emit canUndoChanged(canUndo());
   emit commandGroupEnded();
@@ -254,8 +280,8 @@ void UndoStack::abortCmdGroup() {
     mActiveCommandGroup->undo();  // can throw (but should usually not)
     mActiveCommandGroup = nullptr;
     mCurrentIndex--;
-    delete mCommands.takeLast();  // delete and remove the aborted command group
-                                  // from the stack
+    deleteLastCommand();  // delete and remove the aborted command group from
+                          // the stack
   } catch (Exception& e) {
     qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
     throw;
@@ -331,8 +357,9 @@ void UndoStack::clear() noexcept {
   // delete all commands in the stack from top to bottom (newest first, oldest
   // last)!
   while (!mCommands.isEmpty()) {
-    delete mCommands.takeLast();
+    deleteLastCommand();
   }
+  Q_ASSERT(mMemoryUsage == 0);
 
   mCurrentIndex = 0;
   mCleanIndex = 0;
@@ -346,6 +373,64 @@ void UndoStack::clear() noexcept {
   emit cleanChanged(true);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void UndoStack::appendCommand(UndoCommand* cmd) noexcept {
+  qint64 usage = cmd->getApproximateMemoryUsage();
+  mCommands.append(cmd);
+  mCommandMemoryUsages.append(usage);
+  mMemoryUsage += usage;
+}
+
+void UndoStack::deleteLastCommand() noexcept {
+  mMemoryUsage -= mCommandMemoryUsages.takeLast();
+  delete mCommands.takeLast();
+}
+
+void UndoStack::discardOldestCommands() noexcept {
+  // Always keep the newest undoable command (and the active command group,
+  // which is always the newest command), and never discard redoable commands.
+  int discardedCommands = 0;
+  bool cleanStateLost = false;
+  while ((mCurrentIndex > 1) && isLimitExceeded()) {
+    mMemoryUsage -= mCommandMemoryUsages.takeFirst();
+    delete mCommands.takeFirst();
+    mCurrentIndex--;
+    if (mCleanIndex == 0) {
+      // the clean state is no longer reachable by undoing
+      qInfo() << "Undo stack limit reached, the last saved state can no"
+              << "longer be restored by undo.";
+      mCleanIndex = -1;
+      cleanStateLost = true;
+    } else if (mCleanIndex > 0) {
+      mCleanIndex--;
+    }
+    ++discardedCommands;
+  }
+  if (discardedCommands > 0) {
+    qDebug() << "Discarded the" << discardedCommands
+             << "oldest command(s) from the undo stack, now using approx."
+             << mMemoryUsage / 1024 << "kB for" << mCommands.count()
+             << "command(s) (limits:" << mMaxMemoryUsage / 1024 << "kB,"
+             << mMaxCommandCount << "commands).";
+  }
+  if (cleanStateLost) {
+    emit cleanStateDiscarded();
+  }
+}
+
+bool UndoStack::isLimitExceeded() const noexcept {
+  if ((mMaxCommandCount > 0) && (mCommands.count() > mMaxCommandCount)) {
+    return true;
+  }
+  if ((mMaxMemoryUsage > 0) && (mMemoryUsage > mMaxMemoryUsage)) {
+    return true;
+  }
+  return false;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
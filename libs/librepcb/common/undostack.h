@@ -167,6 +167,38 @@ public:
    */
   bool isCommandGroupActive() const noexcept;
 
+  /**
+   * @brief Get the number of commands in the stack (both undo and redo)
+   *
+   * @return Number of commands
+   */
+  int getCommandCount() const noexcept { return mCommands.count(); }
+
+  /**
+   * @brief Get the approximate memory used by all commands in the stack
+   *
+   * @return Memory usage in bytes (see
+   *         UndoCommand#getApproximateMemoryUsage())
+   *
+   * @note  The usage of the currently active command group is only updated
+   *        when it gets committed.
+   */
+  qint64 getMemoryUsage() const noexcept { return mMemoryUsage; }
+
+  /**
+   * @brief Get the maximum number of commands in the stack
+   *
+   * @return Maximum command count (0 = unlimited)
+   */
+  int getMaxCommandCount() const noexcept { return mMaxCommandCount; }
+
+  /**
+   * @brief Get the maximum memory usage of the stack
+   *
+   * @return Maximum memory usage in bytes (0 = unlimited)
+   */
+  qint64 getMaxMemoryUsage() const noexcept { return mMaxMemoryUsage; }
+
   // Setters
 
   /**
@@ -174,6 +206,25 @@ public:
    */
   void setClean() noexcept;
 
+  /**
+   * @brief Set the maximum number of commands in the stack
+   *
+   * If the limit is exceeded, the oldest commands are discarded. But the
+   * newest command which can be undone is always kept.
+   *
+   * @param count     Maximum command count (0 = unlimited)
+   */
+  void setMaxCommandCount(int count) noexcept;
+
+  /**
+   * @brief Set the maximum memory usage of the stack
+   *
+   * Works the same way as #setMaxCommandCount().
+   *
+   * @param bytes     Maximum memory usage in bytes (0 = unlimited)
+   */
+  void setMaxMemoryUsage(qint64 bytes) noexcept;
+
   // General Methods
 
   /**
@@ -286,11 +337,26 @@ signals:
   void canUndoChanged(bool canUndo);
   void canRedoChanged(bool canRedo);
   void cleanChanged(bool clean);
+
+  /**
+   * @brief Emitted when the clean state was removed from the stack
+   *
+   * This happens if the limits set with #setMaxCommandCount() or
+   * #setMaxMemoryUsage() require discarding the command which led to the
+   * last saved state. From then on, undoing no longer restores that state.
+   */
+  void cleanStateDiscarded();
+
   void commandGroupEnded();
   void commandGroupAborted();
   void stateModified();
 
 private:
+  void appendCommand(UndoCommand* cmd) noexcept;
+  void deleteLastCommand() noexcept;
+  void discardOldestCommands() noexcept;
+  bool isLimitExceeded() const noexcept;
+
   /**
    * @brief This list holds all commands of the undo stack
    *
@@ -299,6 +365,16 @@ private:
    */
   QList<UndoCommand*> mCommands;
 
+  /**
+   * @brief The approximate memory usage of each command in #mCommands
+   *
+   * Same order as #mCommands, the sum is stored in #mMemoryUsage.
+   */
+  QList<qint64> mCommandMemoryUsages;
+  qint64 mMemoryUsage;  ///< Sum of #mCommandMemoryUsages
+  int mMaxCommandCount;  ///< See #setMaxCommandCount()
+  qint64 mMaxMemoryUsage;  ///< See #setMaxMemoryUsage()
+
   /**
    * @brief This attribute holds the current position in the undo stack
    * #mCommands
@@ -57,10 +57,25 @@ EditorWidgetBase::EditorWidgetBase(const Context& context, const FilePath& fp,
     mStatusBar(nullptr),
     mIsInterfaceBroken(false) {
   mUndoStack.reset(new UndoStack());
+  mUndoStack->setMaxCommandCount(
+      mContext.workspace.getSettings().undoStackMaxCommands.get());
+  mUndoStack->setMaxMemoryUsage(
+      qint64(mContext.workspace.getSettings().undoStackMaxMemoryMiB.get()) *
+      1024 * 1024);
   connect(mUndoStack.data(), &UndoStack::cleanChanged, this,
           &EditorWidgetBase::undoStackCleanChanged);
   connect(mUndoStack.data(), &UndoStack::stateModified, this,
           &EditorWidgetBase::undoStackStateModified);
+  connect(mUndoStack.data(), &UndoStack::cleanStateDiscarded, this, [this]() {
+    if (mStatusBar) {
+      mStatusBar->showMessage(
+          tr("The undo history limit has been reached (%1 steps, %2 MiB), "
+             "undo can no longer restore the last saved state.")
+              .arg(mUndoStack->getCommandCount())
+              .arg(mUndoStack->getMemoryUsage() / (1024 * 1024)),
+          10000);
+    }
+  });
 
   mCommandToolBarProxy.reset(new ToolBarProxy());
 
@@ -294,15 +294,16 @@ void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
   QHash<FilePath, QString> elementNames;
 
   try {
-    // get all library element names
-    QList<FilePath> elements =
-        mContext.workspace.getLibraryDb().getLibraryElements<ElementType>(
-            mLibrary->getDirectory().getAbsPath());  // can throw
-    foreach (const FilePath& filepath, elements) {
-      QString name;
-      mContext.workspace.getLibraryDb().getElementTranslations<ElementType>(
-          filepath, getLibLocaleOrder(), &name);  // can throw
-      elementNames.insert(filepath, name);
+    // get all library element names with a single database query
+    QList<workspace::WorkspaceLibraryDb::ElementMetadata> elements =
+        mContext.workspace.getLibraryDb()
+            .getLibraryElementsMetadata<ElementType>(
+                mLibrary->getDirectory().getAbsPath(),
+                getLibLocaleOrder());  // can throw
+    elementNames.reserve(elements.count());
+    foreach (const workspace::WorkspaceLibraryDb::ElementMetadata& element,
+             elements) {
+      elementNames.insert(element.filePath, element.name);
     }
   } catch (const Exception& e) {
     listWidget.clear();
@@ -315,6 +316,9 @@ void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
     return;
   }
 
+  // avoid repainting the list for every single item
+  listWidget.setUpdatesEnabled(false);
+
   // update/remove existing list widget items
   for (int i = listWidget.count() - 1; i >= 0; --i) {
     QListWidgetItem* item = listWidget.item(i);
@@ -339,6 +343,7 @@ void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
 
   // apply filter
   updateElementListFilter(listWidget);
+  listWidget.setUpdatesEnabled(true);
 }
 
 QHash<QListWidgetItem*, FilePath>
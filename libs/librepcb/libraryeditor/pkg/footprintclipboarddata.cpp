@@ -68,6 +68,23 @@ FootprintClipboardData::FootprintClipboardData(const SExpression& node,
 FootprintClipboardData::~FootprintClipboardData() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 FootprintClipboardData::getApproximateMemoryUsage() const noexcept {
+  qint64 usage = sizeof(FootprintClipboardData) +
+      mPackagePads.count() * sizeof(PackagePad) +
+      mFootprintPads.count() * sizeof(FootprintPad) +
+      mCircles.count() * sizeof(Circle) +
+      mStrokeTexts.count() * sizeof(StrokeText) + mHoles.count() * sizeof(Hole);
+  for (const Polygon& polygon : mPolygons) {
+    usage += sizeof(Polygon) +
+        polygon.getPath().getVertices().count() * sizeof(Vertex);
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -87,6 +87,13 @@ public:
   HoleList& getHoles() noexcept { return mHoles; }
   const HoleList& getHoles() const noexcept { return mHoles; }
 
+  /**
+   * @brief Get the approximate memory usage of the contained items
+   *
+   * @return Approximate memory usage in bytes
+   */
+  qint64 getApproximateMemoryUsage() const noexcept;
+
   // General Methods
   std::unique_ptr<QMimeData> toMimeData(const IF_GraphicsLayerProvider& lp);
   static std::unique_ptr<FootprintClipboardData> fromMimeData(
@@ -63,6 +63,15 @@ CmdPasteFootprintItems::CmdPasteFootprintItems(
 CmdPasteFootprintItems::~CmdPasteFootprintItems() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdPasteFootprintItems::getApproximateMemoryUsage() const noexcept {
+  return UndoCommandGroup::getApproximateMemoryUsage() +
+      mData->getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -62,6 +62,9 @@ public:
                          const Point& posOffset) noexcept;
   ~CmdPasteFootprintItems() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdPasteFootprintItems& operator=(const CmdPasteFootprintItems& rhs) = delete;
 
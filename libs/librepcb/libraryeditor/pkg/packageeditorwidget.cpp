@@ -67,6 +67,8 @@ PackageEditorWidget::PackageEditorWidget(const Context& context,
   setupErrorNotificationWidget(*mUi->errorNotificationWidget);
   mUi->graphicsView->setUseOpenGl(
       mContext.workspace.getSettings().useOpenGl.get());
+  mUi->graphicsView->setUsePartialViewportUpdates(
+      mContext.workspace.getSettings().usePartialViewportUpdates.get());
   mUi->graphicsView->setScene(mGraphicsScene.data());
   mUi->graphicsView->setBackgroundBrush(Qt::black);
   mUi->graphicsView->setForegroundBrush(Qt::white);
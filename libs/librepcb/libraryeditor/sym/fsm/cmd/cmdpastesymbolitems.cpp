@@ -61,6 +61,15 @@ CmdPasteSymbolItems::CmdPasteSymbolItems(
 CmdPasteSymbolItems::~CmdPasteSymbolItems() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdPasteSymbolItems::getApproximateMemoryUsage() const noexcept {
+  return UndoCommandGroup::getApproximateMemoryUsage() +
+      mData->getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -60,6 +60,9 @@ public:
                       const Point& posOffset) noexcept;
   ~CmdPasteSymbolItems() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdPasteSymbolItems& operator=(const CmdPasteSymbolItems& rhs) = delete;
 
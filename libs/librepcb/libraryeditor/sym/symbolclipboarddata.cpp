@@ -61,6 +61,21 @@ SymbolClipboardData::SymbolClipboardData(const SExpression& node,
 SymbolClipboardData::~SymbolClipboardData() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 SymbolClipboardData::getApproximateMemoryUsage() const noexcept {
+  qint64 usage = sizeof(SymbolClipboardData) +
+      mPins.count() * sizeof(SymbolPin) + mCircles.count() * sizeof(Circle) +
+      mTexts.count() * sizeof(Text);
+  for (const Polygon& polygon : mPolygons) {
+    usage += sizeof(Polygon) +
+        polygon.getPath().getVertices().count() * sizeof(Vertex);
+  }
+  return usage;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -77,6 +77,13 @@ public:
   TextList& getTexts() noexcept { return mTexts; }
   const TextList& getTexts() const noexcept { return mTexts; }
 
+  /**
+   * @brief Get the approximate memory usage of the contained items
+   *
+   * @return Approximate memory usage in bytes
+   */
+  qint64 getApproximateMemoryUsage() const noexcept;
+
   // General Methods
   std::unique_ptr<QMimeData> toMimeData(const IF_GraphicsLayerProvider& lp);
   static std::unique_ptr<SymbolClipboardData> fromMimeData(
@@ -72,6 +72,8 @@ SymbolEditorWidget::SymbolEditorWidget(const Context& context,
   setupErrorNotificationWidget(*mUi->errorNotificationWidget);
   mUi->graphicsView->setUseOpenGl(
       mContext.workspace.getSettings().useOpenGl.get());
+  mUi->graphicsView->setUsePartialViewportUpdates(
+      mContext.workspace.getSettings().usePartialViewportUpdates.get());
   mUi->graphicsView->setScene(mGraphicsScene.data());
   connect(mUi->graphicsView, &GraphicsView::cursorScenePositionChanged, this,
           &SymbolEditorWidget::cursorPositionChanged);
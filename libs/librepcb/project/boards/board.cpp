@@ -79,6 +79,7 @@ Board::Board(const Board& other,
     mProject(other.getProject()),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mNetLineUpdatesDeferralLevel(0),
     mUuid(Uuid::createRandom()),
     mName(name),
     mDefaultFontFileName(other.mDefaultFontFileName) {
@@ -186,11 +187,13 @@ Board::Board(const Board& other,
 
 Board::Board(Project& project,
              std::unique_ptr<TransactionalDirectory> directory,
-             const Version& fileFormat, bool create, const QString& newName)
+             const Version& fileFormat, bool create, const QString& newName,
+             const SExpression* preparsedRoot)
   : QObject(&project),
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mNetLineUpdatesDeferralLevel(0),
     mUuid(Uuid::createRandom()),
     mName("New Board") {
   try {
@@ -227,8 +230,12 @@ Board::Board(Project& project,
                       Path::rect(Point(0, 0), Point(100000000, 80000000)));
       mPolygons.append(new BI_Polygon(*this, polygon));
     } else {
-      SExpression root = SExpression::parse(
-          mDirectory->read(getFilePath().getFilename()), getFilePath());
+      SExpression parsedRoot;
+      if (!preparsedRoot) {
+        parsedRoot = SExpression::parse(
+            mDirectory->read(getFilePath().getFilename()), getFilePath());
+      }
+      const SExpression& root = preparsedRoot ? *preparsedRoot : parsedRoot;
 
       // the board seems to be ready to open, so we will create all needed
       // objects
@@ -839,6 +846,28 @@ void Board::forceAirWiresRebuild() noexcept {
   triggerAirWiresRebuild();
 }
 
+/*******************************************************************************
+ *  NetLine Methods
+ ******************************************************************************/
+
+void Board::scheduleNetLineUpdate(BI_NetLine& netline) noexcept {
+  if (mNetLineUpdatesDeferralLevel > 0) {
+    mScheduledNetLineUpdates.insert(&netline);
+  } else {
+    netline.updateLine();
+  }
+}
+
+void Board::endDeferredNetLineUpdates() noexcept {
+  Q_ASSERT(mNetLineUpdatesDeferralLevel > 0);
+  if (--mNetLineUpdatesDeferralLevel == 0) {
+    foreach (BI_NetLine* netline, mScheduledNetLineUpdates) {
+      netline->updateLine();
+    }
+    mScheduledNetLineUpdates.clear();
+  }
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -127,6 +127,10 @@ public:
   Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
         const Version& fileFormat)
     : Board(project, std::move(directory), fileFormat, false, QString()) {}
+  Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
+        const Version& fileFormat, const SExpression& root)
+    : Board(project, std::move(directory), fileFormat, false, QString(),
+            &root) {}
   ~Board() noexcept;
 
   // Getters: General
@@ -235,6 +239,37 @@ public:
   void triggerAirWiresRebuild() noexcept;
   void forceAirWiresRebuild() noexcept;
 
+  // NetLine Methods
+
+  /**
+   * @brief Update the given netline, or defer it if requested
+   *
+   * Items which move their netline anchors (e.g. pads, vias or netpoints)
+   * call this instead of updating the netlines directly. Within a
+   * #beginDeferredNetLineUpdates() / #endDeferredNetLineUpdates() block,
+   * each netline is updated only once at the end of the block, even if both
+   * of its anchors were moved (possibly multiple times).
+   *
+   * @param netline   The netline to update
+   */
+  void scheduleNetLineUpdate(BI_NetLine& netline) noexcept;
+
+  /**
+   * @brief Start deferring netline updates
+   *
+   * @note  Calls to this method must be balanced with
+   *        #endDeferredNetLineUpdates() within the same synchronous operation,
+   *        i.e. no netlines must be removed from the board in between.
+   */
+  void beginDeferredNetLineUpdates() noexcept {
+    ++mNetLineUpdatesDeferralLevel;
+  }
+
+  /**
+   * @brief Stop deferring netline updates and execute all scheduled ones
+   */
+  void endDeferredNetLineUpdates() noexcept;
+
   // General Methods
   void addToProject();
   void removeFromProject();
@@ -292,7 +327,8 @@ signals:
 
 private:
   Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
-        const Version& fileFormat, bool create, const QString& newName);
+        const Version& fileFormat, bool create, const QString& newName,
+        const SExpression* preparsedRoot = nullptr);
   void updateIcon() noexcept;
   void updateErcMessages() noexcept;
 
@@ -312,6 +348,8 @@ private:
   QScopedPointer<BoardUserSettings> mUserSettings;
   QRectF mViewRect;
   QSet<NetSignal*> mScheduledNetSignalsForAirWireRebuild;
+  int mNetLineUpdatesDeferralLevel;
+  QSet<BI_NetLine*> mScheduledNetLineUpdates;
 
   // Attributes
   Uuid mUuid;
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "boardgerberexport.h"
 
+#include "../circuit/netsignal.h"
 #include "../metadata/projectmetadata.h"
 #include "../project.h"
 #include "board.h"
@@ -43,13 +44,18 @@
 #include <librepcb/common/boarddesignrules.h>
 #include <librepcb/common/cam/excellongenerator.h>
 #include <librepcb/common/cam/gerbergenerator.h>
+#include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/geometry/hole.h>
 #include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/utils/clipperhelpers.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -65,6 +71,9 @@ BoardGerberExport::BoardGerberExport(
   : mProject(board.getProject()),
     mBoard(board),
     mSettings(new BoardFabricationOutputSettings(settings)),
+    mParallelExport(false),
+    mOptimizeDrillPaths(false),
+    mMergeCopperRegions(false),
     mCurrentInnerCopperLayer(0) {
 }
 
@@ -86,25 +95,11 @@ FilePath BoardGerberExport::getOutputDirectory() const noexcept {
 void BoardGerberExport::exportAllLayers() const {
   mWrittenFiles.clear();
 
-  if (mSettings->getMergeDrillFiles()) {
-    exportDrills();
+  QVector<ExportJob> jobs = prepareJobs();
+  if (mParallelExport) {
+    runJobsParallel(jobs);  // can throw
   } else {
-    exportDrillsNpth();
-    exportDrillsPth();
-  }
-  exportLayerBoardOutlines();
-  exportLayerTopCopper();
-  exportLayerInnerCopper();
-  exportLayerBottomCopper();
-  exportLayerTopSolderMask();
-  exportLayerBottomSolderMask();
-  exportLayerTopSilkscreen();
-  exportLayerBottomSilkscreen();
-  if (mSettings->getEnableSolderPasteTop()) {
-    exportLayerTopSolderPaste();
-  }
-  if (mSettings->getEnableSolderPasteBot()) {
-    exportLayerBottomSolderPaste();
+    runJobsSequentially(jobs);  // can throw
   }
 }
 
@@ -130,19 +125,124 @@ QVector<const AttributeProvider*>
  *  Private Methods
  ******************************************************************************/
 
-void BoardGerberExport::exportDrills() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixDrills());
+QVector<BoardGerberExport::ExportJob> BoardGerberExport::prepareJobs() const {
+  QVector<ExportJob> jobs;
+  auto addLayerJob = [&](const QString& suffix, const QString& layer) {
+    jobs.append(ExportJob{
+        getOutputFilePath(suffix),
+        [this, layer](const FilePath& fp) { return exportLayer(fp, layer); }});
+  };
+  auto addSilkscreenJob = [&](const QString& suffix, const QStringList& layers,
+                              const QString& stopMaskLayer) {
+    // don't create silkscreen file if no layers selected
+    if (!layers.isEmpty()) {
+      jobs.append(ExportJob{
+          getOutputFilePath(suffix),
+          [this, layers, stopMaskLayer](const FilePath& fp) {
+            return exportLayerSilkscreen(fp, layers, stopMaskLayer);
+          }});
+    }
+  };
+
+  if (mSettings->getMergeDrillFiles()) {
+    jobs.append(
+        ExportJob{getOutputFilePath(mSettings->getSuffixDrills()),
+                  [this](const FilePath& fp) { return exportDrills(fp); }});
+  } else {
+    jobs.append(
+        ExportJob{getOutputFilePath(mSettings->getSuffixDrillsNpth()),
+                  [this](const FilePath& fp) { return exportDrillsNpth(fp); }});
+    jobs.append(
+        ExportJob{getOutputFilePath(mSettings->getSuffixDrillsPth()),
+                  [this](const FilePath& fp) { return exportDrillsPth(fp); }});
+  }
+  addLayerJob(mSettings->getSuffixOutlines(), GraphicsLayer::sBoardOutlines);
+  addLayerJob(mSettings->getSuffixCopperTop(), GraphicsLayer::sTopCopper);
+  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
+    mCurrentInnerCopperLayer = i;  // used for attribute provider
+    addLayerJob(mSettings->getSuffixCopperInner(),
+                GraphicsLayer::getInnerLayerName(i));
+  }
+  mCurrentInnerCopperLayer = 0;
+  addLayerJob(mSettings->getSuffixCopperBot(), GraphicsLayer::sBotCopper);
+  addLayerJob(mSettings->getSuffixSolderMaskTop(), GraphicsLayer::sTopStopMask);
+  addLayerJob(mSettings->getSuffixSolderMaskBot(), GraphicsLayer::sBotStopMask);
+  addSilkscreenJob(mSettings->getSuffixSilkscreenTop(),
+                   mSettings->getSilkscreenLayersTop(),
+                   GraphicsLayer::sTopStopMask);
+  addSilkscreenJob(mSettings->getSuffixSilkscreenBot(),
+                   mSettings->getSilkscreenLayersBot(),
+                   GraphicsLayer::sBotStopMask);
+  if (mSettings->getEnableSolderPasteTop()) {
+    addLayerJob(mSettings->getSuffixSolderPasteTop(),
+                GraphicsLayer::sTopSolderPaste);
+  }
+  if (mSettings->getEnableSolderPasteBot()) {
+    addLayerJob(mSettings->getSuffixSolderPasteBot(),
+                GraphicsLayer::sBotSolderPaste);
+  }
+
+  return jobs;
+}
+
+void BoardGerberExport::runJobsSequentially(
+    const QVector<ExportJob>& jobs) const {
+  foreach (const ExportJob& job, jobs) {
+    if (job.function(job.filePath)) {  // can throw
+      mWrittenFiles.append(job.filePath);
+    }
+  }
+}
+
+void BoardGerberExport::runJobsParallel(const QVector<ExportJob>& jobs) const {
+  // Create all output directories in advance to avoid races between the
+  // worker threads when creating the same directory concurrently.
+  foreach (const ExportJob& job, jobs) {
+    FileUtils::makePath(job.filePath.getParentDir());  // can throw
+  }
+
+  QVector<QFuture<bool>> futures;
+  foreach (const ExportJob& job, jobs) {
+    futures.append(
+        QtConcurrent::run([job]() { return job.function(job.filePath); }));
+  }
+
+  // Wait until *all* jobs are finished before (re-)throwing any exception
+  // since the running jobs still access this object. Our exceptions are
+  // derived from QException, thus they are transferred across threads.
+  std::unique_ptr<Exception> error;
+  for (int i = 0; i < futures.count(); ++i) {
+    try {
+      if (futures[i].result()) {  // can throw
+        mWrittenFiles.append(jobs.at(i).filePath);
+      }
+    } catch (const Exception& e) {
+      if (!error) error.reset(e.clone());
+    } catch (const QUnhandledException&) {
+      if (!error) {
+        error.reset(new LogicError(__FILE__, __LINE__,
+                                   "Unhandled exception in export job."));
+      }
+    }
+  }
+  if (error) {
+    error->raise();
+  }
+}
+
+bool BoardGerberExport::exportDrills(const FilePath& fp) const {
   ExcellonGenerator gen;
+  gen.setPathOptimizationEnabled(mOptimizeDrillPaths);
   drawPthDrills(gen);
   drawNpthDrills(gen);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return true;
 }
 
-void BoardGerberExport::exportDrillsNpth() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixDrillsNpth());
+bool BoardGerberExport::exportDrillsNpth(const FilePath& fp) const {
   ExcellonGenerator gen;
+  gen.setPathOptimizationEnabled(mOptimizeDrillPaths);
   int count = drawNpthDrills(gen);
   if (count > 0) {
     // Some PCB manufacturers don't like to have separate drill files for PTH
@@ -151,143 +251,44 @@ void BoardGerberExport::exportDrillsNpth() const {
     // issues with manufacturers...
     gen.generate();
     gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    return true;
+  } else {
+    return false;
   }
 }
 
-void BoardGerberExport::exportDrillsPth() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixDrillsPth());
+bool BoardGerberExport::exportDrillsPth(const FilePath& fp) const {
   ExcellonGenerator gen;
+  gen.setPathOptimizationEnabled(mOptimizeDrillPaths);
   drawPthDrills(gen);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
-}
-
-void BoardGerberExport::exportLayerBoardOutlines() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixOutlines());
-  GerberGenerator gen(
-      mProject.getMetadata().getName() % " - " % mBoard.getName(),
-      mBoard.getUuid(), mProject.getMetadata().getVersion());
-  drawLayer(gen, GraphicsLayer::sBoardOutlines);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
-}
-
-void BoardGerberExport::exportLayerTopCopper() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixCopperTop());
-  GerberGenerator gen(
-      mProject.getMetadata().getName() % " - " % mBoard.getName(),
-      mBoard.getUuid(), mProject.getMetadata().getVersion());
-  drawLayer(gen, GraphicsLayer::sTopCopper);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
-}
-
-void BoardGerberExport::exportLayerBottomCopper() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixCopperBot());
-  GerberGenerator gen(
-      mProject.getMetadata().getName() % " - " % mBoard.getName(),
-      mBoard.getUuid(), mProject.getMetadata().getVersion());
-  drawLayer(gen, GraphicsLayer::sBotCopper);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
-}
-
-void BoardGerberExport::exportLayerInnerCopper() const {
-  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
-    mCurrentInnerCopperLayer = i;  // used for attribute provider
-    FilePath fp = getOutputFilePath(mSettings->getSuffixCopperInner());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::getInnerLayerName(i));
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-  mCurrentInnerCopperLayer = 0;
-}
-
-void BoardGerberExport::exportLayerTopSolderMask() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderMaskTop());
-  GerberGenerator gen(
-      mProject.getMetadata().getName() % " - " % mBoard.getName(),
-      mBoard.getUuid(), mProject.getMetadata().getVersion());
-  drawLayer(gen, GraphicsLayer::sTopStopMask);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
-}
-
-void BoardGerberExport::exportLayerBottomSolderMask() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderMaskBot());
-  GerberGenerator gen(
-      mProject.getMetadata().getName() % " - " % mBoard.getName(),
-      mBoard.getUuid(), mProject.getMetadata().getVersion());
-  drawLayer(gen, GraphicsLayer::sBotStopMask);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return true;
 }
 
-void BoardGerberExport::exportLayerTopSilkscreen() const {
-  QStringList layers = mSettings->getSilkscreenLayersTop();
-  if (layers.count() >
-      0) {  // don't create silkscreen file if no layers selected
-    FilePath fp = getOutputFilePath(mSettings->getSuffixSilkscreenTop());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    foreach (const QString& layer, layers) { drawLayer(gen, layer); }
-    gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, GraphicsLayer::sTopStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-}
-
-void BoardGerberExport::exportLayerBottomSilkscreen() const {
-  QStringList layers = mSettings->getSilkscreenLayersBot();
-  if (layers.count() >
-      0) {  // don't create silkscreen file if no layers selected
-    FilePath fp = getOutputFilePath(mSettings->getSuffixSilkscreenBot());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    foreach (const QString& layer, layers) { drawLayer(gen, layer); }
-    gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, GraphicsLayer::sBotStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-}
-
-void BoardGerberExport::exportLayerTopSolderPaste() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderPasteTop());
+bool BoardGerberExport::exportLayer(const FilePath& fp,
+                                    const QString& layerName) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
-  drawLayer(gen, GraphicsLayer::sTopSolderPaste);
+  drawLayer(gen, layerName);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return true;
 }
 
-void BoardGerberExport::exportLayerBottomSolderPaste() const {
-  FilePath fp = getOutputFilePath(mSettings->getSuffixSolderPasteBot());
+bool BoardGerberExport::exportLayerSilkscreen(
+    const FilePath& fp, const QStringList& layers,
+    const QString& stopMaskLayer) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
-  drawLayer(gen, GraphicsLayer::sBotSolderPaste);
+  foreach (const QString& layer, layers) { drawLayer(gen, layer); }
+  gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
+  drawLayer(gen, stopMaskLayer);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  return true;
 }
 
 int BoardGerberExport::drawNpthDrills(ExcellonGenerator& gen) const {
@@ -357,27 +358,32 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
     }
   }
 
-  // draw traces
-  foreach (const BI_NetSegment* netsegment,
-           sortedByUuid(mBoard.getNetSegments())) {
-    Q_ASSERT(netsegment);
-    foreach (const BI_NetLine* netline,
-             sortedByUuid(netsegment->getNetLines())) {
-      Q_ASSERT(netline);
-      if (netline->getLayer().getName() == layerName) {
-        gen.drawLine(netline->getStartPoint().getPosition(),
-                     netline->getEndPoint().getPosition(),
-                     positiveToUnsigned(netline->getWidth()));
+  if (isCopperMerged(layerName)) {
+    // draw pads, vias, traces and planes as merged regions
+    drawMergedCopper(gen, layerName);
+  } else {
+    // draw traces
+    foreach (const BI_NetSegment* netsegment,
+             sortedByUuid(mBoard.getNetSegments())) {
+      Q_ASSERT(netsegment);
+      foreach (const BI_NetLine* netline,
+               sortedByUuid(netsegment->getNetLines())) {
+        Q_ASSERT(netline);
+        if (netline->getLayer().getName() == layerName) {
+          gen.drawLine(netline->getStartPoint().getPosition(),
+                       netline->getEndPoint().getPosition(),
+                       positiveToUnsigned(netline->getWidth()));
+        }
       }
     }
-  }
 
-  // draw planes
-  foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) {
-    Q_ASSERT(plane);
-    if (plane->getLayerName() == layerName) {
-      foreach (const Path& fragment, plane->getFragments()) {
-        gen.drawPathArea(fragment);
+    // draw planes
+    foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) {
+      Q_ASSERT(plane);
+      if (plane->getLayerName() == layerName) {
+        foreach (const Path& fragment, plane->getFragments()) {
+          gen.drawPathArea(fragment);
+        }
       }
     }
   }
@@ -414,9 +420,112 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
   }
 }
 
+void BoardGerberExport::drawMergedCopper(GerberGenerator& gen,
+                                         const QString& layerName) const {
+  const PositiveLength maxArcTolerance(5000);
+
+  // Collect the copper areas grouped by net signal. The key is the UUID of
+  // the net signal (empty for unconnected pads) to get a reproducible order.
+  QMap<QString, ClipperLib::Paths> areas;
+  auto key = [](const NetSignal* netsignal) {
+    return netsignal ? netsignal->getUuid().toStr() : QString();
+  };
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+      if (pad->isOnLayer(layerName)) {
+        areas[key(pad->getCompSigInstNetSignal())].push_back(
+            ClipperHelpers::convert(pad->getSceneOutline(), maxArcTolerance));
+      }
+    }
+  }
+  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+    ClipperLib::Paths& paths = areas[key(netsegment->getNetSignal())];
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      if (via->isOnLayer(layerName)) {
+        paths.push_back(ClipperHelpers::convert(
+            via->getVia().getSceneOutline(), maxArcTolerance));
+      }
+    }
+    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+      if (netline->getLayer().getName() == layerName) {
+        paths.push_back(ClipperHelpers::convert(netline->getSceneOutline(),
+                                                maxArcTolerance));
+      }
+    }
+  }
+  foreach (const BI_Plane* plane, mBoard.getPlanes()) {
+    if (plane->getLayerName() == layerName) {
+      ClipperLib::Paths& paths = areas[key(&plane->getNetSignal())];
+      foreach (const Path& fragment, plane->getFragments()) {
+        paths.push_back(ClipperHelpers::convert(fragment, maxArcTolerance));
+      }
+    }
+  }
+
+  // Unite the areas of each net signal in parallel. Since the objects are
+  // overlapping, all paths get the same orientation and are united with the
+  // non-zero fill rule. Gerber regions must not contain holes, so these are
+  // converted to cut-ins.
+  QList<QFuture<QVector<Path>>> futures;
+  foreach (const ClipperLib::Paths& paths, areas) {
+    futures.append(QtConcurrent::run([paths]() -> QVector<Path> {
+      try {
+        ClipperLib::Clipper c;
+        foreach (ClipperLib::Path path, paths) {
+          if (!ClipperLib::Orientation(path)) {
+            ClipperLib::ReversePath(path);
+          }
+          c.AddPath(path, ClipperLib::ptSubject, true);
+        }
+        ClipperLib::PolyTree tree;
+        c.Execute(ClipperLib::ctUnion, tree, ClipperLib::pftNonZero,
+                  ClipperLib::pftNonZero);
+        return ClipperHelpers::convert(
+            ClipperHelpers::flattenTree(tree));  // can throw
+      } catch (const Exception&) {
+        throw;
+      } catch (const std::exception& e) {
+        // Only our own exceptions are transferred across threads, so convert
+        // exceptions thrown by Clipper.
+        throw RuntimeError(
+            __FILE__, __LINE__,
+            QString("Failed to merge copper areas: %1").arg(e.what()));
+      }
+    }));
+  }
+
+  // Wait until *all* jobs are finished before (re-)throwing any exception,
+  // a failed merge must abort the export instead of omitting copper.
+  QVector<QVector<Path>> results;
+  std::unique_ptr<Exception> error;
+  foreach (QFuture<QVector<Path>> future, futures) {
+    try {
+      results.append(future.result());  // can throw
+    } catch (const Exception& e) {
+      if (!error) error.reset(e.clone());
+    } catch (const QUnhandledException&) {
+      if (!error) {
+        error.reset(new LogicError(__FILE__, __LINE__,
+                                   "Unhandled exception in merge job."));
+      }
+    }
+  }
+  if (error) {
+    error->raise();
+  }
+  foreach (const QVector<Path>& paths, results) {
+    foreach (const Path& path, paths) { gen.drawPathArea(path); }
+  }
+}
+
+bool BoardGerberExport::isCopperMerged(const QString& layerName) const
+    noexcept {
+  return mMergeCopperRegions && GraphicsLayer::isCopperLayer(layerName);
+}
+
 void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
                                 const QString& layerName) const {
-  bool drawCopper = via.isOnLayer(layerName);
+  bool drawCopper = via.isOnLayer(layerName) && (!isCopperMerged(layerName));
   bool drawStopMask = (layerName == GraphicsLayer::sTopStopMask ||
                        layerName == GraphicsLayer::sBotStopMask) &&
       mBoard.getDesignRules().doesViaRequireStopMask(*via.getDrillDiameter());
@@ -517,7 +626,9 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen,
                                          const QString& layerName) const {
   bool isSmt =
       pad.getLibPad().getBoardSide() != library::FootprintPad::BoardSide::THT;
-  bool isOnCopperLayer = pad.isOnLayer(layerName);
+  // on copper layers, pads may already be drawn as merged regions
+  bool isOnCopperLayer =
+      pad.isOnLayer(layerName) && (!isCopperMerged(layerName));
   bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::sTopCopper) &&
       (layerName == GraphicsLayer::sTopStopMask);
   bool isOnSolderMaskBottom = pad.isOnLayer(GraphicsLayer::sBotCopper) &&
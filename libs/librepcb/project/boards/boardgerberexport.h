@@ -30,6 +30,7 @@
 #include <QtCore>
 
 #include <algorithm>
+#include <functional>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -70,10 +71,64 @@ public:
 
   // Getters
   FilePath getOutputDirectory() const noexcept;
+  bool isParallelExportEnabled() const noexcept { return mParallelExport; }
+  bool isDrillPathOptimizationEnabled() const noexcept {
+    return mOptimizeDrillPaths;
+  }
+  bool isCopperRegionsMergingEnabled() const noexcept {
+    return mMergeCopperRegions;
+  }
   const QVector<FilePath>& getWrittenFiles() const noexcept {
     return mWrittenFiles;
   }
 
+  // Setters
+
+  /**
+   * @brief Enable or disable the parallel export mode
+   *
+   * If enabled, each output file is generated and written on its own worker
+   * thread of the global thread pool. The output is identical to the
+   * sequential mode (including the order of #getWrittenFiles()). The board
+   * is only accessed read-only, but it must not be modified while
+   * #exportAllLayers() is running (it blocks until all files are written).
+   *
+   * @param parallel    Whether the parallel export mode shall be used.
+   */
+  void setParallelExportEnabled(bool parallel) noexcept {
+    mParallelExport = parallel;
+  }
+
+  /**
+   * @brief Enable or disable the drill path optimization of Excellon files
+   *
+   * @param optimize    Whether the drill hits shall be reordered to reduce
+   *                    the travel distance of the drill head.
+   *
+   * @see librepcb::ExcellonGenerator::setPathOptimizationEnabled()
+   */
+  void setDrillPathOptimizationEnabled(bool optimize) noexcept {
+    mOptimizeDrillPaths = optimize;
+  }
+
+  /**
+   * @brief Enable or disable merging of copper into regions
+   *
+   * If enabled, all pads, vias, traces and plane fragments of a net on a
+   * copper layer are united to areas which are then exported as regions
+   * (G36/G37) instead of exporting every object as separate (overlapping)
+   * primitive. This significantly reduces the amount of geometry for
+   * downstream CAM tools. The nets are processed in parallel.
+   *
+   * @note Arcs (e.g. of round pads) are approximated by line segments in
+   *       this mode.
+   *
+   * @param merge   Whether copper shall be merged into regions or not.
+   */
+  void setCopperRegionsMergingEnabled(bool merge) noexcept {
+    mMergeCopperRegions = merge;
+  }
+
   // General Methods
   void exportAllLayers() const;
 
@@ -91,24 +146,37 @@ signals:
   void attributesChanged() override;
 
 private:
+  // Private Types
+
+  /**
+   * @brief A single output file to be generated
+   *
+   * The file path is determined in advance (i.e. in the calling thread)
+   * since the attribute substitution is not thread-safe. The function
+   * generates and writes the file, and returns whether the file was written
+   * or not (e.g. the NPTH drills file is omitted if there are no NPTH drills).
+   */
+  struct ExportJob {
+    FilePath filePath;
+    std::function<bool(const FilePath&)> function;
+  };
+
   // Private Methods
-  void exportDrills() const;
-  void exportDrillsNpth() const;
-  void exportDrillsPth() const;
-  void exportLayerBoardOutlines() const;
-  void exportLayerTopCopper() const;
-  void exportLayerInnerCopper() const;
-  void exportLayerBottomCopper() const;
-  void exportLayerTopSolderMask() const;
-  void exportLayerBottomSolderMask() const;
-  void exportLayerTopSilkscreen() const;
-  void exportLayerBottomSilkscreen() const;
-  void exportLayerTopSolderPaste() const;
-  void exportLayerBottomSolderPaste() const;
+  QVector<ExportJob> prepareJobs() const;
+  void runJobsSequentially(const QVector<ExportJob>& jobs) const;
+  void runJobsParallel(const QVector<ExportJob>& jobs) const;
+  bool exportDrills(const FilePath& fp) const;
+  bool exportDrillsNpth(const FilePath& fp) const;
+  bool exportDrillsPth(const FilePath& fp) const;
+  bool exportLayer(const FilePath& fp, const QString& layerName) const;
+  bool exportLayerSilkscreen(const FilePath& fp, const QStringList& layers,
+                             const QString& stopMaskLayer) const;
 
   int drawNpthDrills(ExcellonGenerator& gen) const;
   int drawPthDrills(ExcellonGenerator& gen) const;
   void drawLayer(GerberGenerator& gen, const QString& layerName) const;
+  void drawMergedCopper(GerberGenerator& gen, const QString& layerName) const;
+  bool isCopperMerged(const QString& layerName) const noexcept;
   void drawVia(GerberGenerator& gen, const BI_Via& via,
                const QString& layerName) const;
   void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint,
@@ -135,6 +203,9 @@ private:
   const Project& mProject;
   const Board& mBoard;
   QScopedPointer<const BoardFabricationOutputSettings> mSettings;
+  bool mParallelExport;
+  bool mOptimizeDrillPaths;
+  bool mMergeCopperRegions;
   mutable int mCurrentInnerCopperLayer;
   mutable QVector<FilePath> mWrittenFiles;
 };
@@ -55,6 +55,15 @@ CmdBoardNetSegmentAdd::CmdBoardNetSegmentAdd(Board& board,
 CmdBoardNetSegmentAdd::~CmdBoardNetSegmentAdd() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdBoardNetSegmentAdd::getApproximateMemoryUsage() const noexcept {
+  return UndoCommand::getApproximateMemoryUsage() +
+      (mNetSegment ? mNetSegment->getApproximateMemoryUsage() : 0);
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -53,6 +53,7 @@ public:
 
   // Getters
   BI_NetSegment* getNetSegment() const noexcept { return mNetSegment; }
+  qint64 getApproximateMemoryUsage() const noexcept override;
 
 private:
   // Private Methods
@@ -47,6 +47,15 @@ CmdBoardNetSegmentRemove::CmdBoardNetSegmentRemove(
 CmdBoardNetSegmentRemove::~CmdBoardNetSegmentRemove() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdBoardNetSegmentRemove::getApproximateMemoryUsage() const noexcept {
+  return UndoCommand::getApproximateMemoryUsage() +
+      mNetSegment.getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
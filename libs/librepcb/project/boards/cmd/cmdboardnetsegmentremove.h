@@ -49,6 +49,9 @@ public:
   explicit CmdBoardNetSegmentRemove(BI_NetSegment& segment) noexcept;
   ~CmdBoardNetSegmentRemove() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
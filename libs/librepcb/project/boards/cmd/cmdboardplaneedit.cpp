@@ -68,6 +68,16 @@ CmdBoardPlaneEdit::~CmdBoardPlaneEdit() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdBoardPlaneEdit::getApproximateMemoryUsage() const noexcept {
+  int vertices = mOldOutline.getVertices().capacity() +
+      mNewOutline.getVertices().capacity();
+  return UndoCommand::getApproximateMemoryUsage() + vertices * sizeof(Vertex);
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
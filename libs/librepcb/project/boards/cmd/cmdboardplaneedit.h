@@ -51,6 +51,9 @@ public:
   CmdBoardPlaneEdit(BI_Plane& plane, bool rebuildOnChanges) noexcept;
   ~CmdBoardPlaneEdit() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
   // Setters
   void translate(const Point& deltaPos, bool immediate) noexcept;
   void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
@@ -44,6 +44,15 @@ CmdDeviceInstanceAdd::CmdDeviceInstanceAdd(BI_Device& device) noexcept
 CmdDeviceInstanceAdd::~CmdDeviceInstanceAdd() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdDeviceInstanceAdd::getApproximateMemoryUsage() const noexcept {
+  return UndoCommand::getApproximateMemoryUsage() +
+      mDeviceInstance.getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -57,6 +57,9 @@ public:
   explicit CmdDeviceInstanceAdd(BI_Device& device) noexcept;
   ~CmdDeviceInstanceAdd() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
 private:  // Methods
   /// @copydoc UndoCommand::performExecute()
   bool performExecute() override;
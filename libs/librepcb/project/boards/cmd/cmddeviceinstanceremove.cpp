@@ -46,6 +46,15 @@ CmdDeviceInstanceRemove::CmdDeviceInstanceRemove(BI_Device& dev) noexcept
 CmdDeviceInstanceRemove::~CmdDeviceInstanceRemove() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdDeviceInstanceRemove::getApproximateMemoryUsage() const noexcept {
+  return UndoCommand::getApproximateMemoryUsage() +
+      mDevice.getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -49,6 +49,9 @@ public:
   CmdDeviceInstanceRemove(BI_Device& dev) noexcept;
   ~CmdDeviceInstanceRemove() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
@@ -55,6 +55,43 @@
 namespace librepcb {
 namespace project {
 
+/*******************************************************************************
+ *  Class BoardDesignRuleCheck::Options
+ ******************************************************************************/
+
+BoardDesignRuleCheck::Options::Options(const SExpression& node,
+                                       const Version& fileFormat)
+  : Options() {
+  auto load = [&](const QString& name, UnsignedLength& value) {
+    if (const SExpression* child = node.tryGetChild(name % "/@0")) {
+      value = deserialize<UnsignedLength>(*child, fileFormat);  // can throw
+    }
+  };
+  load("min_copper_width", minCopperWidth);
+  load("min_copper_copper_clearance", minCopperCopperClearance);
+  load("min_copper_board_clearance", minCopperBoardClearance);
+  load("min_copper_npth_clearance", minCopperNpthClearance);
+  load("min_pth_restring", minPthRestring);
+  load("min_npth_drill_diameter", minNpthDrillDiameter);
+  load("min_pth_drill_diameter", minPthDrillDiameter);
+  if (const SExpression* child = node.tryGetChild("courtyard_offset/@0")) {
+    courtyardOffset = deserialize<Length>(*child, fileFormat);  // can throw
+  }
+}
+
+void BoardDesignRuleCheck::Options::serialize(SExpression& root) const {
+  root.appendChild("min_copper_width", minCopperWidth, true);
+  root.appendChild("min_copper_copper_clearance", minCopperCopperClearance,
+                   true);
+  root.appendChild("min_copper_board_clearance", minCopperBoardClearance,
+                   true);
+  root.appendChild("min_copper_npth_clearance", minCopperNpthClearance, true);
+  root.appendChild("min_pth_restring", minPthRestring, true);
+  root.appendChild("min_npth_drill_diameter", minNpthDrillDiameter, true);
+  root.appendChild("min_pth_drill_diameter", minPthDrillDiameter, true);
+  root.appendChild("courtyard_offset", courtyardOffset, true);
+}
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -76,16 +113,33 @@ void BoardDesignRuleCheck::execute() {
   emit progressPercent(5);
 
   mMessages.clear();
+  mStageDurations.clear();
+
+  // measure execution time of each check to allow tracking the performance
+  QElapsedTimer timer;
+  timer.start();
+  auto stageFinished = [&](const QString& name) {
+    mStageDurations.append(StageDuration(name, timer.restart()));
+  };
 
   rebuildPlanes(5, 15);
+  stageFinished("rebuild_planes");
   checkCopperBoardClearances(15, 40);
+  stageFinished("copper_board_clearances");
   checkCopperCopperClearances(40, 70);
+  stageFinished("copper_copper_clearances");
   checkMinimumCopperWidth(70, 72);
+  stageFinished("minimum_copper_width");
   checkMinimumPthRestring(72, 74);
+  stageFinished("minimum_pth_restring");
   checkMinimumPthDrillDiameter(74, 76);
+  stageFinished("minimum_pth_drill_diameter");
   checkMinimumNpthDrillDiameter(76, 78);
+  stageFinished("minimum_npth_drill_diameter");
   checkCourtyardClearances(78, 88);
+  stageFinished("courtyard_clearances");
   checkForMissingConnections(88, 90);
+  stageFinished("missing_connections");
 
   emit progressStatus(
       tr("Finished with %1 message(s)!", "Count of messages", mMessages.count())
@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include "boarddesignrulecheckmessage.h"
 
+#include <librepcb/common/fileio/sexpression.h>
 #include <polyclipping/clipper.hpp>
 
 #include <QtCore>
@@ -74,8 +75,32 @@ public:
         minPthDrillDiameter(250000),  // 250um
         courtyardOffset(0)  // 0um
     {}
+
+    /**
+     * @brief Load options from an S-Expression node
+     *
+     * All values are optional, missing values keep their default value.
+     *
+     * @param node        The node to load the options from.
+     * @param fileFormat  The file format of the node.
+     *
+     * @throw Exception if a value is invalid.
+     */
+    Options(const SExpression& node, const Version& fileFormat);
+
+    /**
+     * @brief Serialize all options (in the format expected by the constructor)
+     *
+     * @param root  The node to append the options to.
+     */
+    void serialize(SExpression& root) const;
   };
 
+  /**
+   * @brief Execution time of a single check (name and duration in ms)
+   */
+  typedef QPair<QString, qint64> StageDuration;
+
   // Constructors / Destructor
   explicit BoardDesignRuleCheck(Board& board, const Options& options,
                                 QObject* parent = nullptr) noexcept;
@@ -85,6 +110,9 @@ public:
   const QList<BoardDesignRuleCheckMessage>& getMessages() const noexcept {
     return mMessages;
   }
+  const QList<StageDuration>& getStageDurations() const noexcept {
+    return mStageDurations;
+  }
 
   // General Methods
   void execute();
@@ -124,6 +152,7 @@ private:  // Data
   Board& mBoard;
   Options mOptions;
   QList<BoardDesignRuleCheckMessage> mMessages;
+  QList<StageDuration> mStageDurations;
   QHash<const GraphicsLayer*, QHash<const NetSignal*, ClipperLib::Paths>>
       mCachedPaths;
 };
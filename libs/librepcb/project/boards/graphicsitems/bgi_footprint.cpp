@@ -74,6 +74,7 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept {
 
   mBoundingRect = QRectF();
   mShape = QPainterPath();
+  mPrimitives.clear();
 
   // set Z value
   if (mFootprint.getIsMirrored())
@@ -96,9 +97,18 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept {
   for (const Polygon& polygon : mLibFootprint.getPolygons()) {
     layer = getLayer(*polygon.getLayerName());
     if (!layer) continue;
-    if (!layer->isVisible()) continue;
 
     QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
+    GraphicsLayer* fillLayer = nullptr;
+    if (polygon.isFilled() && polygon.getPath().isClosed()) {
+      fillLayer = layer;
+    } else if (polygon.isGrabArea()) {
+      fillLayer = getLayer(GraphicsLayer::sTopGrabAreas);
+    }
+    addPrimitive(layer, true, polygon.getLineWidth()->toPx(), fillLayer,
+                 polygonPath);
+
+    if (!layer->isVisible()) continue;
     qreal w = polygon.getLineWidth()->toPx() / 2;
     mBoundingRect =
         mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
@@ -109,6 +119,35 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept {
     mShape = mShape.united(polygonPath);
   }
 
+  // circles
+  for (const Circle& circle : mLibFootprint.getCircles()) {
+    layer = getLayer(*circle.getLayerName());
+    if (!layer) continue;
+
+    GraphicsLayer* fillLayer = nullptr;
+    if (circle.isFilled()) {
+      fillLayer = layer;
+    } else if (circle.isGrabArea()) {
+      fillLayer = getLayer(GraphicsLayer::sTopGrabAreas);
+    }
+    qreal radius = circle.getDiameter()->toPx() / 2;
+    QPainterPath circlePath;
+    circlePath.addEllipse(circle.getCenter().toPxQPointF(), radius, radius);
+    addPrimitive(layer, true, circle.getLineWidth()->toPx(), fillLayer,
+                 circlePath);
+  }
+
+  // holes
+  layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
+  if (layer) {
+    for (const Hole& hole : mLibFootprint.getHoles()) {
+      qreal radius = (hole.getDiameter() / 2).toPx();
+      QPainterPath holePath;
+      holePath.addEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+      addPrimitive(layer, false, 0, layer, holePath);
+    }
+  }
+
   if (!mShape.isEmpty()) mShape.setFillRule(Qt::WindingFill);
 
   setVisible(!mBoundingRect.isEmpty());
@@ -123,95 +162,42 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept {
 void BGI_Footprint::paint(QPainter* painter,
                           const QStyleOptionGraphicsItem* option,
                           QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
 
   const GraphicsLayer* layer = 0;
   const bool selected = mFootprint.isSelected();
   const bool deviceIsPrinter =
       (dynamic_cast<QPrinter*>(painter->device()) != 0);
-
-  // draw all polygons
-  for (const Polygon& polygon : mLibFootprint.getPolygons()) {
-    // get layer
-    layer = getLayer(*polygon.getLayerName());
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    // set pen
-    painter->setPen(QPen(layer->getColor(selected),
-                         polygon.getLineWidth()->toPx(), Qt::SolidLine,
-                         Qt::RoundCap, Qt::RoundJoin));
-
-    // set brush
-    if ((!polygon.isFilled()) || (!polygon.getPath().isClosed())) {
-      if (polygon.isGrabArea())
-        layer = getLayer(GraphicsLayer::sTopGrabAreas);
-      else
-        layer = nullptr;
-    }
-    if (layer) {
-      if (layer->isVisible())
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-      else
-        painter->setBrush(Qt::NoBrush);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+
+  // draw all polygons, circles and holes
+  foreach (const CachedPrimitive& primitive, mPrimitives) {
+    if (!primitive.layer->isVisible()) continue;
+
+    // skip primitives which are smaller than a pixel on the screen
+    if ((!deviceIsPrinter) && (primitive.sizePx * lod < 1)) continue;
+
+    // set pen (lines thinner than a pixel are drawn as faster cosmetic lines)
+    if (primitive.stroke) {
+      qreal width = primitive.lineWidthPx;
+      if ((!deviceIsPrinter) && (width * lod < 1)) width = 0;
+      painter->setPen(QPen(primitive.layer->getColor(selected), width,
+                           Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
     } else {
-      painter->setBrush(Qt::NoBrush);
+      painter->setPen(Qt::NoPen);
     }
 
-    // draw polygon
-    painter->drawPath(polygon.getPath().toQPainterPathPx());
-  }
-
-  // draw all circles
-  for (const Circle& circle : mLibFootprint.getCircles()) {
-    // get layer
-    layer = getLayer(*circle.getLayerName());
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    // set pen
-    painter->setPen(QPen(layer->getColor(selected),
-                         circle.getLineWidth()->toPx(), Qt::SolidLine,
-                         Qt::RoundCap, Qt::RoundJoin));
-
     // set brush
-    if (!circle.isFilled()) {
-      if (circle.isGrabArea())
-        layer = getLayer(GraphicsLayer::sTopGrabAreas);
-      else
-        layer = nullptr;
-    }
-    if (layer) {
-      if (layer->isVisible())
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-      else
-        painter->setBrush(Qt::NoBrush);
+    if (primitive.fillLayer && primitive.fillLayer->isVisible()) {
+      painter->setBrush(
+          QBrush(primitive.fillLayer->getColor(selected), Qt::SolidPattern));
     } else {
       painter->setBrush(Qt::NoBrush);
     }
 
-    // draw circle
-    painter->drawEllipse(circle.getCenter().toPxQPointF(),
-                         circle.getDiameter()->toPx() / 2,
-                         circle.getDiameter()->toPx() / 2);
-    // TODO: rotation
-  }
-
-  // draw all holes
-  for (const Hole& hole : mLibFootprint.getHoles()) {
-    // get layer
-    layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    // set pen/brush
-    painter->setPen(Qt::NoPen);
-    painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-
-    // draw hole
-    qreal radius = (hole.getDiameter() / 2).toPx();
-    painter->drawEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+    // draw primitive
+    painter->drawPath(primitive.path);
   }
 
   // draw origin cross
@@ -242,6 +228,20 @@ void BGI_Footprint::paint(QPainter* painter,
  *  Private Methods
  ******************************************************************************/
 
+void BGI_Footprint::addPrimitive(GraphicsLayer* layer, bool stroke,
+                                 qreal lineWidthPx, GraphicsLayer* fillLayer,
+                                 const QPainterPath& path) noexcept {
+  QRectF rect = path.boundingRect();
+  CachedPrimitive primitive;
+  primitive.layer = layer;
+  primitive.stroke = stroke;
+  primitive.lineWidthPx = lineWidthPx;
+  primitive.fillLayer = fillLayer;
+  primitive.path = path;
+  primitive.sizePx = qMax(rect.width(), rect.height()) + lineWidthPx;
+  mPrimitives.append(primitive);
+}
+
 GraphicsLayer* BGI_Footprint::getLayer(QString name) const noexcept {
   if (mFootprint.getIsMirrored())
     name = GraphicsLayer::getMirroredLayerName(name);
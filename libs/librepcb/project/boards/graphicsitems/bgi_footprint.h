@@ -75,7 +75,20 @@ private:
   BGI_Footprint(const BGI_Footprint& other) = delete;
   BGI_Footprint& operator=(const BGI_Footprint& rhs) = delete;
 
+  // Types
+  struct CachedPrimitive {
+    GraphicsLayer* layer;  ///< The primitive is only drawn if it is visible
+    bool stroke;  ///< Whether the outline is drawn or not
+    qreal lineWidthPx;  ///< Width of the outline
+    GraphicsLayer* fillLayer;  ///< Layer of the fill (nullptr = no fill)
+    QPainterPath path;
+    qreal sizePx;  ///< The larger dimension of the bounding rect
+  };
+
   // Private Methods
+  void addPrimitive(GraphicsLayer* layer, bool stroke, qreal lineWidthPx,
+                    GraphicsLayer* fillLayer,
+                    const QPainterPath& path) noexcept;
   GraphicsLayer* getLayer(QString name) const noexcept;
 
   // General Attributes
@@ -85,6 +98,7 @@ private:
   // Cached Attributes
   QRectF mBoundingRect;
   QPainterPath mShape;
+  QVector<CachedPrimitive> mPrimitives;
 };
 
 /*******************************************************************************
@@ -137,54 +137,69 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
 void BGI_FootprintPad::paint(QPainter* painter,
                              const QStyleOptionGraphicsItem* option,
                              QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
-  // const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) !=
-  // 0); const qreal lod =
-  // option->levelOfDetailFromTransform(painter->worldTransform());
+  const bool deviceIsPrinter =
+      (dynamic_cast<QPrinter*>(painter->device()) != nullptr);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
 
   const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
   bool highlight =
       mPad.isSelected() || (netsignal && netsignal->isHighlighted());
 
+  // If the pad is only a few pixels large on the screen, draw all shapes as
+  // rectangles since this is a lot faster and looks (almost) the same.
+  const bool simplified =
+      (!deviceIsPrinter) &&
+      (qMax(mBoundingRect.width(), mBoundingRect.height()) * lod < 4);
+  auto drawPath = [painter, simplified](const QPainterPath& path) {
+    if (simplified) {
+      painter->drawRect(path.boundingRect());
+    } else {
+      painter->drawPath(path);
+    }
+  };
+
   if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
     // draw bottom cream mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomCreamMaskLayer->getColor(highlight));
-    painter->drawPath(mCreamMask);
+    drawPath(mCreamMask);
   }
 
   if (mBottomStopMaskLayer && mBottomStopMaskLayer->isVisible()) {
     // draw bottom stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    drawPath(mStopMask);
   }
 
   if (mPadLayer && mPadLayer->isVisible()) {
     // draw pad
     painter->setPen(Qt::NoPen);
     painter->setBrush(mPadLayer->getColor(highlight));
-    painter->drawPath(mCopper);
-    // draw pad text
-    painter->setFont(mFont);
-    painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-    painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
-                      mPad.getDisplayText());
+    drawPath(mCopper);
+    // draw pad text (only if large enough to be readable)
+    if (deviceIsPrinter || (mFont.pixelSize() * lod > 4)) {
+      painter->setFont(mFont);
+      painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+      painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
+                        mPad.getDisplayText());
+    }
   }
 
   if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
     // draw top stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    drawPath(mStopMask);
   }
 
   if (mTopCreamMaskLayer && mTopCreamMaskLayer->isVisible()) {
     // draw top cream mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopCreamMaskLayer->getColor(highlight));
-    painter->drawPath(mCreamMask);
+    drawPath(mCreamMask);
   }
 
 #ifdef QT_DEBUG
@@ -99,17 +99,21 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept {
 void BGI_NetLine::paint(QPainter* painter,
                         const QStyleOptionGraphicsItem* option,
                         QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
+  const bool deviceIsPrinter =
+      (dynamic_cast<QPrinter*>(painter->device()) != nullptr);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
 
   const NetSignal* netsignal = mNetLine.getNetSegment().getNetSignal();
   bool highlight =
       mNetLine.isSelected() || (netsignal && netsignal->isHighlighted());
 
-  // draw line
+  // draw line (lines thinner than a pixel are drawn as faster cosmetic lines)
   if (mLayer->isVisible()) {
-    QPen pen(mLayer->getColor(highlight), mNetLine.getWidth()->toPx(),
-             Qt::SolidLine, Qt::RoundCap);
+    qreal width = mNetLine.getWidth()->toPx();
+    if ((!deviceIsPrinter) && (width * lod < 1)) width = 0;
+    QPen pen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap);
     painter->setPen(pen);
     painter->drawLine(mLineF);
   }
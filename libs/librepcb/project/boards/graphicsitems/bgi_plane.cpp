@@ -119,9 +119,12 @@ void BGI_Plane::updateCacheAndRepaint() noexcept {
 
   // get areas
   mAreas.clear();
+  mAreaSizesPx.clear();
   for (const Path& r : mPlane.getFragments()) {
     mAreas.append(r.toQPainterPathPx());
-    mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
+    QRectF rect = mAreas.last().boundingRect();
+    mAreaSizesPx.append(qMax(rect.width(), rect.height()));
+    mBoundingRect = mBoundingRect.united(rect);
   }
 
   update();
@@ -164,9 +167,19 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
 
     // draw plane only if plane should be visible
     if (mPlane.isVisible()) {
+      // Areas which are smaller than a pixel on the screen are skipped and
+      // areas which are only a few pixels large are drawn as rectangles
+      // since this is a lot faster and looks (almost) the same.
       painter->setPen(Qt::NoPen);
       painter->setBrush(mLayer->getColor(selected));
-      foreach (const QPainterPath& area, mAreas) { painter->drawPath(area); }
+      for (int i = 0; i < mAreas.count(); ++i) {
+        qreal sizePx = mAreaSizesPx.at(i) * lod;
+        if (deviceIsPrinter || (sizePx >= 4)) {
+          painter->drawPath(mAreas.at(i));
+        } else if (sizePx >= 1) {
+          painter->drawRect(mAreas.at(i).boundingRect());
+        }
+      }
     }
   }
 
@@ -99,6 +99,7 @@ private:
   QPainterPath mShape;
   QPainterPath mOutline;
   QVector<QPainterPath> mAreas;
+  QVector<qreal> mAreaSizesPx;  ///< Larger dimension of each area in #mAreas
   qreal mLineWidthPx;
   qreal mVertexRadiusPx;
 };
@@ -105,29 +105,45 @@ void BGI_Via::updateCacheAndRepaint() noexcept {
 
 void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                     QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
+  const bool deviceIsPrinter =
+      (dynamic_cast<QPrinter*>(painter->device()) != nullptr);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
 
   const NetSignal* netsignal = mVia.getNetSegment().getNetSignal();
   bool highlight =
       mVia.isSelected() || (netsignal && netsignal->isHighlighted());
 
+  // If the via is only a few pixels large on the screen, draw all shapes as
+  // rectangles without drill hole since this is a lot faster and looks
+  // (almost) the same.
+  const bool simplified =
+      (!deviceIsPrinter) && (mBoundingRect.width() * lod < 4);
+  auto drawPath = [painter, simplified](const QPainterPath& path) {
+    if (simplified) {
+      painter->drawRect(path.boundingRect());
+    } else {
+      painter->drawPath(path);
+    }
+  };
+
   if (mDrawStopMask && mBottomStopMaskLayer &&
       mBottomStopMaskLayer->isVisible()) {
     // draw bottom stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    drawPath(mStopMask);
   }
 
   if (mViaLayer && mViaLayer->isVisible()) {
     // draw via
     painter->setPen(Qt::NoPen);
     painter->setBrush(mViaLayer->getColor(highlight));
-    painter->drawPath(mCopper);
+    drawPath(mCopper);
 
-    // draw netsignal name
-    if (netsignal) {
+    // draw netsignal name (only if large enough to be readable)
+    if (netsignal && (deviceIsPrinter || (mFont.pixelSize() * lod > 4))) {
       painter->setFont(mFont);
       painter->setPen(mViaLayer->getColor(highlight).lighter(150));
       painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
@@ -139,7 +155,7 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     // draw top stop mask
     painter->setPen(Qt::NoPen);
     painter->setBrush(mTopStopMaskLayer->getColor(highlight));
-    painter->drawPath(mStopMask);
+    drawPath(mStopMask);
   }
 
 #ifdef QT_DEBUG
@@ -30,6 +30,8 @@
 #include "../../settings/projectsettings.h"
 #include "../board.h"
 #include "bi_footprint.h"
+#include "bi_footprintpad.h"
+#include "bi_stroketext.h"
 
 #include <librepcb/common/scopeguard.h>
 #include <librepcb/library/elements.h>
@@ -197,6 +199,12 @@ bool BI_Device::isUsed() const noexcept {
   return mFootprint->isUsed();
 }
 
+qint64 BI_Device::getApproximateMemoryUsage() const noexcept {
+  return sizeof(BI_Device) + sizeof(BI_Footprint) +
+      mFootprint->getPads().count() * sizeof(BI_FootprintPad) +
+      mFootprint->getStrokeTexts().count() * sizeof(BI_StrokeText);
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -94,6 +94,15 @@ public:
   bool isSelectable() const noexcept override;
   bool isUsed() const noexcept;
 
+  /**
+   * @brief Get the approximate memory usage of this device
+   *
+   * Used to limit the memory of undo commands which hold removed devices.
+   *
+   * @return Approximate memory usage in bytes (including footprint and pads)
+   */
+  qint64 getApproximateMemoryUsage() const noexcept;
+
   // Setters
   void setPosition(const Point& pos) noexcept;
   void setRotation(const Angle& rot) noexcept;
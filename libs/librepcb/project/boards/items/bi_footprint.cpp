@@ -314,8 +314,9 @@ void BI_Footprint::deviceInstanceAttributesChanged() {
 }
 
 void BI_Footprint::deviceInstanceMoved(const Point& pos) {
+  // Note: The cached graphics of the footprint and its pads are independent
+  // of position and rotation, thus no need to update them.
   mGraphicsItem->setPos(pos.toPxQPointF());
-  mGraphicsItem->updateCacheAndRepaint();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -326,7 +327,6 @@ void BI_Footprint::deviceInstanceMoved(const Point& pos) {
 void BI_Footprint::deviceInstanceRotated(const Angle& rot) {
   Q_UNUSED(rot);
   updateGraphicsItemTransform();
-  mGraphicsItem->updateCacheAndRepaint();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -339,6 +339,7 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored) {
   mGraphicsItem->updateCacheAndRepaint();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
+    pad->updateGraphicsItem();  // board side depends on mirror state
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
   }
 }
@@ -219,8 +219,13 @@ void BI_FootprintPad::updatePosition() noexcept {
   mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
   mGraphicsItem->setPos(mPosition.toPxQPointF());
   updateGraphicsItemTransform();
+  foreach (BI_NetLine* netline, mRegisteredNetLines) {
+    mBoard.scheduleNetLineUpdate(*netline);
+  }
+}
+
+void BI_FootprintPad::updateGraphicsItem() noexcept {
   mGraphicsItem->updateCacheAndRepaint();
-  foreach (BI_NetLine* netline, mRegisteredNetLines) { netline->updateLine(); }
 }
 
 /*******************************************************************************
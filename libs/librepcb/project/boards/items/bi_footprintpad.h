@@ -87,6 +87,7 @@ public:
   void addToBoard() override;
   void removeFromBoard() override;
   void updatePosition() noexcept;
+  void updateGraphicsItem() noexcept;
 
   // Inherited from BI_Base
   Type_t getType() const noexcept override {
@@ -92,7 +92,9 @@ TraceAnchor BI_NetPoint::toTraceAnchor() const noexcept {
 void BI_NetPoint::setPosition(const Point& position) noexcept {
   if (mJunction.setPosition(position)) {
     mGraphicsItem->setPos(position.toPxQPointF());
-    foreach (BI_NetLine* line, mRegisteredNetLines) { line->updateLine(); }
+    foreach (BI_NetLine* line, mRegisteredNetLines) {
+      mBoard.scheduleNetLineUpdate(*line);
+    }
     if (NetSignal* netsignal = mNetSegment.getNetSignal()) {
       mBoard.scheduleAirWiresRebuild(netsignal);
     }
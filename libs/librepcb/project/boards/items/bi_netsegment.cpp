@@ -35,6 +35,7 @@
 #include "bi_via.h"
 
 #include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/toolbox.h>
 
 #include <QtCore>
 
@@ -68,12 +69,14 @@ BI_NetSegment::BI_NetSegment(Board& board, const BI_NetSegment& other,
     BI_Via* copy = new BI_Via(*this, *via);
     Q_ASSERT(!getViaByUuid(copy->getUuid()));
     mVias.append(copy);
+    mViasByUuid.insert(copy->getUuid(), copy);
     anchorsMap.insert(via, copy);
   }
   // copy netpoints
   foreach (const BI_NetPoint* netpoint, other.mNetPoints) {
     BI_NetPoint* copy = new BI_NetPoint(*this, netpoint->getPosition());
     mNetPoints.append(copy);
+    mNetPointsByUuid.insert(copy->getUuid(), copy);
     anchorsMap.insert(netpoint, copy);
   }
   // copy netlines
@@ -84,6 +87,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const BI_NetSegment& other,
     Q_ASSERT(end);
     BI_NetLine* copy = new BI_NetLine(*this, *netline, *start, *end);
     mNetLines.append(copy);
+    mNetLinesByUuid.insert(copy->getUuid(), copy);
   }
 }
 
@@ -115,6 +119,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node,
                 .arg(via->getUuid().toStr()));
       }
       mVias.append(via);
+      mViasByUuid.insert(via->getUuid(), via);
     }
 
     // Load all netpoints
@@ -127,6 +132,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node,
                 .arg(netpoint->getUuid().toStr()));
       }
       mNetPoints.append(netpoint);
+      mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
     }
 
     // Load all netlines
@@ -140,6 +146,7 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node,
                 .arg(netline->getUuid().toStr()));
       }
       mNetLines.append(netline);
+      mNetLinesByUuid.insert(netline->getUuid(), netline);
     }
 
     if (!areAllNetPointsConnectedTogether()) {
@@ -154,10 +161,13 @@ BI_NetSegment::BI_NetSegment(Board& board, const SExpression& node,
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mNetLines);
     mNetLines.clear();
+    mNetLinesByUuid.clear();
     qDeleteAll(mNetPoints);
     mNetPoints.clear();
+    mNetPointsByUuid.clear();
     qDeleteAll(mVias);
     mVias.clear();
+    mViasByUuid.clear();
     throw;  // ...and rethrow the exception
   }
 }
@@ -170,10 +180,13 @@ BI_NetSegment::~BI_NetSegment() noexcept {
   // delete all items
   qDeleteAll(mNetLines);
   mNetLines.clear();
+  mNetLinesByUuid.clear();
   qDeleteAll(mNetPoints);
   mNetPoints.clear();
+  mNetPointsByUuid.clear();
   qDeleteAll(mVias);
   mVias.clear();
+  mViasByUuid.clear();
 }
 
 /*******************************************************************************
@@ -190,6 +203,12 @@ bool BI_NetSegment::isUsed() const noexcept {
           (!mNetLines.isEmpty()));
 }
 
+qint64 BI_NetSegment::getApproximateMemoryUsage() const noexcept {
+  return sizeof(BI_NetSegment) + mVias.count() * sizeof(BI_Via) +
+      mNetPoints.count() * sizeof(BI_NetPoint) +
+      mNetLines.count() * sizeof(BI_NetLine);
+}
+
 int BI_NetSegment::getViasAtScenePos(const Point& pos,
                                      QList<BI_Via*>& vias) const noexcept {
   int count = 0;
@@ -301,10 +320,7 @@ void BI_NetSegment::setNetSignal(NetSignal* netsignal) {
  ******************************************************************************/
 
 BI_Via* BI_NetSegment::getViaByUuid(const Uuid& uuid) const noexcept {
-  foreach (BI_Via* via, mVias) {
-    if (via->getUuid() == uuid) return via;
-  }
-  return nullptr;
+  return mViasByUuid.value(uuid, nullptr);
 }
 
 /*******************************************************************************
@@ -312,10 +328,7 @@ BI_Via* BI_NetSegment::getViaByUuid(const Uuid& uuid) const noexcept {
  ******************************************************************************/
 
 BI_NetPoint* BI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept {
-  foreach (BI_NetPoint* netpoint, mNetPoints) {
-    if (netpoint->getUuid() == uuid) return netpoint;
-  }
-  return nullptr;
+  return mNetPointsByUuid.value(uuid, nullptr);
 }
 
 /*******************************************************************************
@@ -323,10 +336,7 @@ BI_NetPoint* BI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept {
  ******************************************************************************/
 
 BI_NetLine* BI_NetSegment::getNetLineByUuid(const Uuid& uuid) const noexcept {
-  foreach (BI_NetLine* netline, mNetLines) {
-    if (netline->getUuid() == uuid) return netline;
-  }
-  return nullptr;
+  return mNetLinesByUuid.value(uuid, nullptr);
 }
 
 /*******************************************************************************
@@ -342,7 +352,8 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
 
   ScopeGuardList sgl(netpoints.count() + netlines.count());
   foreach (BI_Via* via, vias) {
-    if ((mVias.contains(via)) || (&via->getNetSegment() != this)) {
+    if ((getViaByUuid(via->getUuid()) == via) ||
+        (&via->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no via with the same uuid in the list
@@ -354,13 +365,15 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
     // add to board
     via->addToBoard();  // can throw
     mVias.append(via);
+    mViasByUuid.insert(via->getUuid(), via);
     sgl.add([this, via]() {
       via->removeFromBoard();
       mVias.removeOne(via);
+      mViasByUuid.remove(via->getUuid());
     });
   }
   foreach (BI_NetPoint* netpoint, netpoints) {
-    if ((mNetPoints.contains(netpoint)) ||
+    if ((getNetPointByUuid(netpoint->getUuid()) == netpoint) ||
         (&netpoint->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
@@ -374,13 +387,16 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
     // add to board
     netpoint->addToBoard();  // can throw
     mNetPoints.append(netpoint);
+    mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
     sgl.add([this, netpoint]() {
       netpoint->removeFromBoard();
       mNetPoints.removeOne(netpoint);
+      mNetPointsByUuid.remove(netpoint->getUuid());
     });
   }
   foreach (BI_NetLine* netline, netlines) {
-    if ((mNetLines.contains(netline)) || (&netline->getNetSegment() != this)) {
+    if ((getNetLineByUuid(netline->getUuid()) == netline) ||
+        (&netline->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no netline with the same uuid in the list
@@ -393,9 +409,11 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
     // add to board
     netline->addToBoard();  // can throw
     mNetLines.append(netline);
+    mNetLinesByUuid.insert(netline->getUuid(), netline);
     sgl.add([this, netline]() {
       netline->removeFromBoard();
       mNetLines.removeOne(netline);
+      mNetLinesByUuid.remove(netline->getUuid());
     });
   }
 
@@ -418,42 +436,55 @@ void BI_NetSegment::removeElements(const QList<BI_Via*>& vias,
 
   ScopeGuardList sgl(netpoints.count() + netlines.count());
   foreach (BI_NetLine* netline, netlines) {
-    if (!mNetLines.contains(netline)) {
+    if (getNetLineByUuid(netline->getUuid()) != netline) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     netline->removeFromBoard();  // can throw
-    mNetLines.removeOne(netline);
+    mNetLinesByUuid.remove(netline->getUuid());
     sgl.add([this, netline]() {
       netline->addToBoard();
-      mNetLines.append(netline);
+      mNetLinesByUuid.insert(netline->getUuid(), netline);
     });
   }
   foreach (BI_NetPoint* netpoint, netpoints) {
-    if (!mNetPoints.contains(netpoint)) {
+    if (getNetPointByUuid(netpoint->getUuid()) != netpoint) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     netpoint->removeFromBoard();  // can throw
-    mNetPoints.removeOne(netpoint);
+    mNetPointsByUuid.remove(netpoint->getUuid());
     sgl.add([this, netpoint]() {
       netpoint->addToBoard();
-      mNetPoints.append(netpoint);
+      mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
     });
   }
   foreach (BI_Via* via, vias) {
-    if (!mVias.contains(via)) {
+    if (getViaByUuid(via->getUuid()) != via) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     via->removeFromBoard();  // can throw
-    mVias.removeOne(via);
+    mViasByUuid.remove(via->getUuid());
     sgl.add([this, via]() {
       via->addToBoard();
-      mVias.append(via);
+      mViasByUuid.insert(via->getUuid(), via);
     });
   }
 
+  // update the lists at once to avoid quadratic complexity for many items
+  QList<BI_Via*> oldVias = mVias;
+  QList<BI_NetPoint*> oldNetPoints = mNetPoints;
+  QList<BI_NetLine*> oldNetLines = mNetLines;
+  Toolbox::removeUnindexedItems(mVias, mViasByUuid);
+  Toolbox::removeUnindexedItems(mNetPoints, mNetPointsByUuid);
+  Toolbox::removeUnindexedItems(mNetLines, mNetLinesByUuid);
+  sgl.add([this, oldVias, oldNetPoints, oldNetLines]() {
+    mVias = oldVias;
+    mNetPoints = oldNetPoints;
+    mNetLines = oldNetLines;
+  });
+
   if (!areAllNetPointsConnectedTogether()) {
     throw LogicError(
         __FILE__, __LINE__,
@@ -609,55 +640,44 @@ bool BI_NetSegment::areAllNetPointsConnectedTogether() const noexcept {
                   // together" :)
   }
   Q_ASSERT(p);
-  QSet<const BI_Via*> vias;
-  QSet<const BI_NetPoint*> points;
-  QSet<const BI_FootprintPad*> pads;
-  findAllConnectedNetPoints(*p, vias, pads, points);
-  return (vias.count() == mVias.count()) &&
-      (points.count() == mNetPoints.count());
+  QSet<const BI_NetLineAnchor*> anchors = findAllConnectedNetLineAnchors(*p);
+  foreach (const BI_Via* via, mVias) {
+    if (!anchors.contains(via)) return false;
+  }
+  foreach (const BI_NetPoint* netpoint, mNetPoints) {
+    if (!anchors.contains(netpoint)) return false;
+  }
+  return true;
 }
 
-void BI_NetSegment::findAllConnectedNetPoints(
-    const BI_NetLineAnchor& p, QSet<const BI_Via*>& vias,
-    QSet<const BI_FootprintPad*>& pads, QSet<const BI_NetPoint*>& points) const
-    noexcept {
-  if (const BI_Via* via = dynamic_cast<const BI_Via*>(&p)) {
-    if (vias.contains(via)) return;
-    vias.insert(via);
-    foreach (const BI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == via) {
-        findAllConnectedNetPoints(netline->getEndPoint(), vias, pads, points);
-      }
-      if (&netline->getEndPoint() == via) {
-        findAllConnectedNetPoints(netline->getStartPoint(), vias, pads, points);
-      }
-    }
-  } else if (const BI_FootprintPad* pad =
-                 dynamic_cast<const BI_FootprintPad*>(&p)) {
-    if (pads.contains(pad)) return;
-    pads.insert(pad);
-    foreach (const BI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == pad) {
-        findAllConnectedNetPoints(netline->getEndPoint(), vias, pads, points);
-      }
-      if (&netline->getEndPoint() == pad) {
-        findAllConnectedNetPoints(netline->getStartPoint(), vias, pads, points);
-      }
-    }
-  } else if (const BI_NetPoint* np = dynamic_cast<const BI_NetPoint*>(&p)) {
-    if (points.contains(np)) return;
-    points.insert(np);
-    foreach (const BI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == np) {
-        findAllConnectedNetPoints(netline->getEndPoint(), vias, pads, points);
-      }
-      if (&netline->getEndPoint() == np) {
-        findAllConnectedNetPoints(netline->getStartPoint(), vias, pads, points);
+QSet<const BI_NetLineAnchor*> BI_NetSegment::findAllConnectedNetLineAnchors(
+    const BI_NetLineAnchor& start) const noexcept {
+  // build adjacency list of all anchors within this segment
+  QHash<const BI_NetLineAnchor*, QVector<const BI_NetLineAnchor*>> adjacency;
+  adjacency.reserve(mVias.count() + mNetPoints.count() + mNetLines.count());
+  foreach (const BI_NetLine* netline, mNetLines) {
+    const BI_NetLineAnchor* p1 = &netline->getStartPoint();
+    const BI_NetLineAnchor* p2 = &netline->getEndPoint();
+    adjacency[p1].append(p2);
+    adjacency[p2].append(p1);
+  }
+
+  // iterative depth-first search to not overflow the stack on long traces
+  QSet<const BI_NetLineAnchor*> visited;
+  visited.reserve(adjacency.count() + 1);
+  QVector<const BI_NetLineAnchor*> stack;
+  visited.insert(&start);
+  stack.append(&start);
+  while (!stack.isEmpty()) {
+    const BI_NetLineAnchor* anchor = stack.takeLast();
+    foreach (const BI_NetLineAnchor* neighbor, adjacency.value(anchor)) {
+      if (!visited.contains(neighbor)) {
+        visited.insert(neighbor);
+        stack.append(neighbor);
       }
     }
-  } else {
-    Q_ASSERT(false);
   }
+  return visited;
 }
 
 /*******************************************************************************
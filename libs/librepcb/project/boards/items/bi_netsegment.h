@@ -93,6 +93,16 @@ public:
   QString getNetNameToDisplay(bool fallback = false) const noexcept;
 
   bool isUsed() const noexcept;
+
+  /**
+   * @brief Get the approximate memory usage of this net segment
+   *
+   * Used to limit the memory of undo commands which hold removed segments.
+   *
+   * @return Approximate memory usage in bytes (including all elements)
+   */
+  qint64 getApproximateMemoryUsage() const noexcept;
+
   int getViasAtScenePos(const Point& pos, QList<BI_Via*>& vias) const noexcept;
   int getNetPointsAtScenePos(const Point& pos, const GraphicsLayer* layer,
                              QList<BI_NetPoint*>& points) const noexcept;
@@ -163,11 +173,8 @@ public:
 private:
   bool checkAttributesValidity() const noexcept;
   bool areAllNetPointsConnectedTogether() const noexcept;
-  void findAllConnectedNetPoints(const BI_NetLineAnchor& p,
-                                 QSet<const BI_Via*>& vias,
-                                 QSet<const BI_FootprintPad*>& pads,
-                                 QSet<const BI_NetPoint*>& points) const
-      noexcept;
+  QSet<const BI_NetLineAnchor*> findAllConnectedNetLineAnchors(
+      const BI_NetLineAnchor& start) const noexcept;
 
   // Attributes
   Uuid mUuid;
@@ -181,6 +188,11 @@ private:
   QList<BI_Via*> mVias;
   QList<BI_NetPoint*> mNetPoints;
   QList<BI_NetLine*> mNetLines;
+
+  // Indices for fast lookup by UUID, always in sync with the lists above
+  QHash<Uuid, BI_Via*> mViasByUuid;
+  QHash<Uuid, BI_NetPoint*> mNetPointsByUuid;
+  QHash<Uuid, BI_NetLine*> mNetLinesByUuid;
 };
 
 /*******************************************************************************
@@ -92,7 +92,7 @@ void BI_Via::setPosition(const Point& position) noexcept {
   if (mVia.setPosition(position)) {
     mGraphicsItem->setPos(position.toPxQPointF());
     foreach (BI_NetLine* netline, mRegisteredNetLines) {
-      netline->updateLine();
+      mBoard.scheduleNetLineUpdate(*netline);
     }
     if (NetSignal* netsignal = mNetSegment.getNetSignal()) {
       mBoard.scheduleAirWiresRebuild(netsignal);
@@ -39,6 +39,36 @@
 namespace librepcb {
 namespace project {
 
+/// Generate the name with the lowest free number for a given prefix, starting
+/// the search at the number memorized for this prefix
+template <typename T>
+static QString generateAutoName(const QString& prefix,
+                                const QHash<QString, T*>& existingNames,
+                                QHash<QString, int>& nextNumbers) noexcept {
+  int& number = nextNumbers[prefix];
+  number = qMax(number, 1);
+  QString name = prefix % QString::number(number);
+  while (existingNames.contains(name)) {
+    name = prefix % QString::number(++number);
+  }
+  return name;
+}
+
+/// Make the number of a no longer used name available again for
+/// auto-generated names
+static void releaseAutoName(QHash<QString, int>& nextNumbers,
+                            const QString& name) noexcept {
+  for (auto it = nextNumbers.begin(); it != nextNumbers.end(); ++it) {
+    if (name.startsWith(it.key())) {
+      bool ok = false;
+      int number = name.mid(it.key().length()).toInt(&ok);
+      if (ok && (number > 0) && (number < it.value())) {
+        it.value() = number;
+      }
+    }
+  }
+}
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -202,12 +232,7 @@ void Circuit::setNetClassName(NetClass& netclass, const ElementName& newName) {
  ******************************************************************************/
 
 QString Circuit::generateAutoNetSignalName() const noexcept {
-  QString name;
-  int i = 1;
-  do {
-    name = QString("N%1").arg(i++);
-  } while (getNetSignalByName(name));
-  return name;
+  return generateAutoName("N", mNetSignalsByName, mNextNetSignalNumbers);
 }
 
 NetSignal* Circuit::getNetSignalByUuid(const Uuid& uuid) const noexcept {
@@ -215,12 +240,7 @@ NetSignal* Circuit::getNetSignalByUuid(const Uuid& uuid) const noexcept {
 }
 
 NetSignal* Circuit::getNetSignalByName(const QString& name) const noexcept {
-  foreach (NetSignal* netsignal, mNetSignals) {
-    if (netsignal->getName() == name) {
-      return netsignal;
-    }
-  }
-  return nullptr;
+  return mNetSignalsByName.value(name, nullptr);
 }
 
 NetSignal* Circuit::getNetSignalWithMostElements() const noexcept {
@@ -255,6 +275,7 @@ void Circuit::addNetSignal(NetSignal& netsignal) {
   // add netsignal to circuit
   netsignal.addToCircuit();  // can throw
   mNetSignals.insert(netsignal.getUuid(), &netsignal);
+  mNetSignalsByName.insert(*netsignal.getName(), &netsignal);
   emit netSignalAdded(netsignal);
 }
 
@@ -266,6 +287,8 @@ void Circuit::removeNetSignal(NetSignal& netsignal) {
   // remove netsignal from circuit
   netsignal.removeFromCircuit();  // can throw
   mNetSignals.remove(netsignal.getUuid());
+  mNetSignalsByName.remove(*netsignal.getName());
+  releaseAutoName(mNextNetSignalNumbers, *netsignal.getName());
   emit netSignalRemoved(netsignal);
 }
 
@@ -283,7 +306,11 @@ void Circuit::setNetSignalName(NetSignal& netsignal,
                            .arg(*newName));
   }
   // apply the new name
+  QString oldName = *netsignal.getName();
   netsignal.setName(newName, isAutoName);  // can throw
+  mNetSignalsByName.remove(oldName);
+  mNetSignalsByName.insert(*newName, &netsignal);
+  releaseAutoName(mNextNetSignalNumbers, oldName);
 }
 
 void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept {
@@ -298,13 +325,9 @@ void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept {
 
 QString Circuit::generateAutoComponentInstanceName(
     const library::ComponentPrefix& cmpPrefix) const noexcept {
-  QString name;
-  int i = 1;
-  do {
-    name =
-        QString("%1%2").arg(cmpPrefix->isEmpty() ? "?" : *cmpPrefix).arg(i++);
-  } while (getComponentInstanceByName(name));
-  return name;
+  return generateAutoName(cmpPrefix->isEmpty() ? "?" : *cmpPrefix,
+                          mComponentInstancesByName,
+                          mNextComponentInstanceNumbers);
 }
 
 ComponentInstance* Circuit::getComponentInstanceByUuid(const Uuid& uuid) const
@@ -314,10 +337,7 @@ ComponentInstance* Circuit::getComponentInstanceByUuid(const Uuid& uuid) const
 
 ComponentInstance* Circuit::getComponentInstanceByName(
     const QString& name) const noexcept {
-  foreach (ComponentInstance* compInstance, mComponentInstances) {
-    if (compInstance->getName() == name) return compInstance;
-  }
-  return nullptr;
+  return mComponentInstancesByName.value(name, nullptr);
 }
 
 void Circuit::addComponentInstance(ComponentInstance& cmp) {
@@ -340,6 +360,7 @@ void Circuit::addComponentInstance(ComponentInstance& cmp) {
   // add to circuit
   cmp.addToCircuit();  // can throw
   mComponentInstances.insert(cmp.getUuid(), &cmp);
+  mComponentInstancesByName.insert(*cmp.getName(), &cmp);
   emit componentAdded(cmp);
 }
 
@@ -351,6 +372,8 @@ void Circuit::removeComponentInstance(ComponentInstance& cmp) {
   // remove from circuit
   cmp.removeFromCircuit();  // can throw
   mComponentInstances.remove(cmp.getUuid());
+  mComponentInstancesByName.remove(*cmp.getName());
+  releaseAutoName(mNextComponentInstanceNumbers, *cmp.getName());
   emit componentRemoved(cmp);
 }
 
@@ -367,7 +390,11 @@ void Circuit::setComponentInstanceName(ComponentInstance& cmp,
         tr("There is already a component with the name \"%1\"!").arg(*newName));
   }
   // apply the new name
+  QString oldName = *cmp.getName();
   cmp.setName(newName);  // can throw
+  mComponentInstancesByName.remove(oldName);
+  mComponentInstancesByName.insert(*newName, &cmp);
+  releaseAutoName(mNextComponentInstanceNumbers, oldName);
 }
 
 /*******************************************************************************
@@ -150,6 +150,15 @@ private:
   QMap<Uuid, NetClass*> mNetClasses;
   QMap<Uuid, NetSignal*> mNetSignals;
   QMap<Uuid, ComponentInstance*> mComponentInstances;
+
+  // Indices for fast lookup by name, always in sync with the maps above
+  QHash<QString, NetSignal*> mNetSignalsByName;
+  QHash<QString, ComponentInstance*> mComponentInstancesByName;
+
+  /// Lowest number per name prefix which might be free for auto-generated
+  /// names (all lower numbers are known to be in use)
+  mutable QHash<QString, int> mNextNetSignalNumbers;
+  mutable QHash<QString, int> mNextComponentInstanceNumbers;
 };
 
 /*******************************************************************************
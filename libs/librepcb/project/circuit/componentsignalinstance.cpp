@@ -24,6 +24,7 @@
 
 #include "../boards/items/bi_footprintpad.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
 #include "../schematics/items/si_symbolpin.h"
 #include "../settings/projectsettings.h"
@@ -105,11 +106,10 @@ void ComponentSignalInstance::init() {
                      .arg(mComponentSignal->getUuid().toStr()),
                  "ForcedNetSignalNameConflict",
                  ErcMsg::ErcMsgType_t::SchematicError, QString()));
-  updateErcMessages();
 
   // register to component attributes changed
   connect(&mComponentInstance, &ComponentInstance::attributesChanged, this,
-          &ComponentSignalInstance::updateErcMessages);
+          &ComponentSignalInstance::scheduleErcMessagesUpdate);
 
   // register to net signal name changed
   if (mNetSignal) {
@@ -118,12 +118,17 @@ void ComponentSignalInstance::init() {
   }
 
   if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
+
+  // schedule this at the end since the destructor is not called if the
+  // constructor throws, i.e. the update could not be cancelled anymore
+  scheduleErcMessagesUpdate();
 }
 
 ComponentSignalInstance::~ComponentSignalInstance() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
   Q_ASSERT(!isUsed());
   Q_ASSERT(!arePinsOrPadsUsed());
+  mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
 }
 
 /*******************************************************************************
@@ -201,7 +206,7 @@ void ComponentSignalInstance::setNetSignal(NetSignal* netsignal) {
   }
   NetSignal* old = mNetSignal;
   mNetSignal = netsignal;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
   sgl.dismiss();
   emit netSignalChanged(old, mNetSignal);
 }
@@ -218,7 +223,7 @@ void ComponentSignalInstance::addToCircuit() {
     mNetSignal->registerComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void ComponentSignalInstance::removeFromCircuit() {
@@ -235,7 +240,7 @@ void ComponentSignalInstance::removeFromCircuit() {
     mNetSignal->unregisterComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void ComponentSignalInstance::registerSymbolPin(SI_SymbolPin& pin) {
@@ -294,7 +299,12 @@ bool ComponentSignalInstance::checkAttributesValidity() const noexcept {
 void ComponentSignalInstance::netSignalNameChanged(
     const CircuitIdentifier& newName) noexcept {
   Q_UNUSED(newName);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
+}
+
+void ComponentSignalInstance::scheduleErcMessagesUpdate() noexcept {
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(
+      *this, [this]() { updateErcMessages(); });
 }
 
 void ComponentSignalInstance::updateErcMessages() noexcept {
@@ -133,11 +133,12 @@ signals:
 private slots:
 
   void netSignalNameChanged(const CircuitIdentifier& newName) noexcept;
-  void updateErcMessages() noexcept;
+  void scheduleErcMessagesUpdate() noexcept;
 
 private:
   void init();
   bool checkAttributesValidity() const noexcept;
+  void updateErcMessages() noexcept;
 
   // General
   Circuit& mCircuit;
@@ -25,6 +25,8 @@
 #include "../boards/items/bi_netsegment.h"
 #include "../boards/items/bi_plane.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include "../schematics/items/si_netsegment.h"
 #include "circuit.h"
 #include "componentinstance.h"
@@ -84,6 +86,7 @@ NetSignal::NetSignal(Circuit& circuit, NetClass& netclass,
 NetSignal::~NetSignal() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
   Q_ASSERT(!isUsed());
+  mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
 }
 
 /*******************************************************************************
@@ -123,7 +126,7 @@ void NetSignal::setName(const CircuitIdentifier& name,
   }
   mName = name;
   mHasAutoName = isAutoName;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
   emit nameChanged(mName);
 }
 
@@ -144,7 +147,7 @@ void NetSignal::addToCircuit() {
   }
   mNetClass->registerNetSignal(*this);  // can throw
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::removeFromCircuit() {
@@ -159,7 +162,7 @@ void NetSignal::removeFromCircuit() {
   }
   mNetClass->unregisterNetSignal(*this);  // can throw
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
@@ -168,7 +171,7 @@ void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.append(&signal);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
@@ -177,7 +180,7 @@ void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.removeOne(&signal);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -191,7 +194,7 @@ void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__, "NetSegment is from other circuit.");
   }
   mRegisteredSchematicNetSegments.append(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -200,7 +203,7 @@ void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSchematicNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
@@ -210,7 +213,7 @@ void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.append(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
@@ -219,7 +222,7 @@ void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::registerBoardPlane(BI_Plane& plane) {
@@ -228,7 +231,7 @@ void NetSignal::registerBoardPlane(BI_Plane& plane) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.append(&plane);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
@@ -236,7 +239,7 @@ void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.removeOne(&plane);
-  updateErcMessages();
+  scheduleErcMessagesUpdate();
 }
 
 void NetSignal::serialize(SExpression& root) const {
@@ -257,6 +260,11 @@ bool NetSignal::checkAttributesValidity() const noexcept {
   return true;
 }
 
+void NetSignal::scheduleErcMessagesUpdate() noexcept {
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(
+      *this, [this]() { updateErcMessages(); });
+}
+
 void NetSignal::updateErcMessages() noexcept {
   if (mIsAddedToCircuit && (!isUsed())) {
     if (!mErcMsgUnusedNetSignal) {
@@ -126,6 +126,7 @@ signals:
 
 private:
   bool checkAttributesValidity() const noexcept;
+  void scheduleErcMessagesUpdate() noexcept;
   void updateErcMessages() noexcept;
 
   // General
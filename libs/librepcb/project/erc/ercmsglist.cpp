@@ -42,12 +42,25 @@ namespace project {
 
 ErcMsgList::ErcMsgList(Project& project)
   : QObject(&project), mProject(project) {
+  mUpdateTimer.setSingleShot(true);
+  mUpdateTimer.setInterval(0);
+  connect(&mUpdateTimer, &QTimer::timeout, this,
+          &ErcMsgList::executeScheduledUpdates);
 }
 
 ErcMsgList::~ErcMsgList() noexcept {
   Q_ASSERT(mItems.isEmpty());
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+const QList<ErcMsg*>& ErcMsgList::getItems() noexcept {
+  executeScheduledUpdates();
+  return mItems;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -75,7 +88,44 @@ void ErcMsgList::update(ErcMsg* ercMsg) noexcept {
   emit ercMsgChanged(ercMsg);
 }
 
+void ErcMsgList::scheduleUpdate(
+    const IF_ErcMsgProvider& provider,
+    const std::function<void()>& callback) noexcept {
+  if (!mScheduledUpdates.contains(&provider)) {
+    mScheduledProviders.append(&provider);
+    mScheduledUpdates.insert(&provider, callback);
+  }
+  if (!mUpdateTimer.isActive()) {
+    mUpdateTimer.start();
+  }
+}
+
+void ErcMsgList::cancelUpdate(const IF_ErcMsgProvider& provider) noexcept {
+  // Note: The provider is not removed from mScheduledProviders to avoid
+  // quadratic complexity when many providers are destroyed. It will just be
+  // skipped since there is no callback for it anymore.
+  mScheduledUpdates.remove(&provider);
+}
+
+void ErcMsgList::executeScheduledUpdates() noexcept {
+  // callbacks might schedule new updates, thus loop until nothing is left
+  while (!mScheduledProviders.isEmpty()) {
+    QList<const IF_ErcMsgProvider*> providers = mScheduledProviders;
+    mScheduledProviders.clear();
+    foreach (const IF_ErcMsgProvider* provider, providers) {
+      std::function<void()> callback = mScheduledUpdates.take(provider);
+      if (callback) {
+        callback();
+      }
+    }
+  }
+  mScheduledUpdates.clear();  // should already be empty
+  mUpdateTimer.stop();
+}
+
 void ErcMsgList::restoreIgnoreState() {
+  executeScheduledUpdates();
+
   QString fp = "circuit/erc.lp";
   if (mProject.getDirectory().fileExists(fp)) {
     SExpression root =
@@ -102,6 +152,7 @@ void ErcMsgList::restoreIgnoreState() {
 }
 
 void ErcMsgList::save() {
+  executeScheduledUpdates();
   SExpression doc(serializeToDomElement("librepcb_erc"));  // can throw
   mProject.getDirectory().write("circuit/erc.lp",
                                 doc.toByteArray());  // can throw
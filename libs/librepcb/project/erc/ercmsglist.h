@@ -29,6 +29,8 @@
 
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -37,6 +39,7 @@ namespace project {
 
 class Project;
 class ErcMsg;
+class IF_ErcMsgProvider;
 
 /*******************************************************************************
  *  Class ErcMsgList
@@ -45,6 +48,13 @@ class ErcMsg;
 /**
  * @brief The ErcMsgList class contains a list of ERC messages which are visible
  * for the user
+ *
+ * ERC message providers should not update their messages immediately on every
+ * modification, but call #scheduleUpdate() instead. All scheduled updates are
+ * then executed at once as soon as control returns to the event loop, or
+ * when the messages are accessed with #getItems(), #restoreIgnoreState() or
+ * #save(). This way bulk operations like loading a project, pasting or
+ * removing many items only update the messages of each provider once.
  */
 class ErcMsgList final : public QObject, public SerializableObject {
   Q_OBJECT
@@ -57,12 +67,36 @@ public:
   ~ErcMsgList() noexcept;
 
   // Getters
-  const QList<ErcMsg*>& getItems() const noexcept { return mItems; }
+  const QList<ErcMsg*>& getItems() noexcept;
 
   // General Methods
   void add(ErcMsg* ercMsg) noexcept;
   void remove(ErcMsg* ercMsg) noexcept;
   void update(ErcMsg* ercMsg) noexcept;
+
+  /**
+   * @brief Schedule an update of the ERC messages of a provider
+   *
+   * Scheduling the same provider multiple times before the update is executed
+   * has no effect, the callback is executed only once.
+   *
+   * @param provider  The provider whose messages need to be updated.
+   * @param callback  The function which updates the messages.
+   */
+  void scheduleUpdate(const IF_ErcMsgProvider& provider,
+                      const std::function<void()>& callback) noexcept;
+
+  /**
+   * @brief Cancel a scheduled update (e.g. because the provider is destroyed)
+   *
+   * @param provider  The provider passed to #scheduleUpdate().
+   */
+  void cancelUpdate(const IF_ErcMsgProvider& provider) noexcept;
+
+  /**
+   * @brief Execute all scheduled updates now
+   */
+  void executeScheduledUpdates() noexcept;
   void restoreIgnoreState();
   void save();
 
@@ -84,6 +118,11 @@ private:  // Methods
 
   // Misc
   QList<ErcMsg*> mItems;  ///< contains all visible ERC messages
+
+  // Scheduled updates (the list determines the order of execution)
+  QList<const IF_ErcMsgProvider*> mScheduledProviders;
+  QHash<const IF_ErcMsgProvider*, std::function<void()>> mScheduledUpdates;
+  QTimer mUpdateTimer;
 };
 
 /*******************************************************************************
@@ -33,6 +33,7 @@
 #include <librepcb/library/pkg/package.h>
 #include <librepcb/library/sym/symbol.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -51,20 +52,34 @@ ProjectLibrary::ProjectLibrary(
     std::unique_ptr<TransactionalDirectory> directory)
   : mDirectory(std::move(directory)) {
   qDebug() << "load project library...";
+  QElapsedTimer timer;
+  timer.start();
+
+  // Load all library elements in worker threads since they are independent
+  // of each other
+  QList<QFuture<Symbol*>> symbols = startLoadingElements<Symbol>("sym");
+  QList<QFuture<Package*>> packages = startLoadingElements<Package>("pkg");
+  QList<QFuture<Component*>> components =
+      startLoadingElements<Component>("cmp");
+  QList<QFuture<Device*>> devices = startLoadingElements<Device>("dev");
 
   try {
-    // Load all library elements
-    loadElements<Symbol>("sym", "symbols", mSymbols);
-    loadElements<Package>("pkg", "packages", mPackages);
-    loadElements<Component>("cmp", "components", mComponents);
-    loadElements<Device>("dev", "devices", mDevices);
+    finishLoadingElements<Symbol>(symbols, "symbols", mSymbols);
+    finishLoadingElements<Package>(packages, "packages", mPackages);
+    finishLoadingElements<Component>(components, "components", mComponents);
+    finishLoadingElements<Device>(devices, "devices", mDevices);
   } catch (const Exception&) {
+    abortLoadingElements<Symbol>(symbols);
+    abortLoadingElements<Package>(packages);
+    abortLoadingElements<Component>(components);
+    abortLoadingElements<Device>(devices);
     qDeleteAll(mAllElements);
     mAllElements.clear();
     throw;
   }
 
-  qDebug() << "project library successfully loaded!";
+  qDebug() << "project library successfully loaded in" << timer.elapsed()
+           << "ms!";
 }
 
 ProjectLibrary::~ProjectLibrary() noexcept {
@@ -143,29 +158,57 @@ void ProjectLibrary::save() {
  ******************************************************************************/
 
 template <typename ElementType>
-void ProjectLibrary::loadElements(const QString& dirname, const QString& type,
-                                  QHash<Uuid, ElementType*>& elementList) {
+QList<QFuture<ElementType*>> ProjectLibrary::startLoadingElements(
+    const QString& dirname) {
+  // The elements are created in worker threads, but they have to live in the
+  // thread of the project library
+  QThread* thread = QThread::currentThread();
+  TransactionalDirectory* directory = mDirectory.get();
+
   // search all subdirectories which have a valid UUID as directory name
+  QList<QFuture<ElementType*>> futures;
   foreach (const QString& sub, mDirectory->getDirs(dirname)) {
-    std::unique_ptr<TransactionalDirectory> dir(
-        new TransactionalDirectory(*mDirectory, dirname % "/" % sub));
-
-    // check if directory is a valid library element
-    if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*dir, "")) {
-      qWarning() << "Found an invalid directory in the library:"
-                 << dir->getAbsPath().toNative();
-      continue;
-    }
+    QString path = dirname % "/" % sub;
+    futures.append(
+        QtConcurrent::run([directory, path, thread]() -> ElementType* {
+          std::unique_ptr<TransactionalDirectory> dir(
+              new TransactionalDirectory(*directory, path));
+
+          // check if directory is a valid library element
+          if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*dir,
+                                                                       "")) {
+            qWarning() << "Found an invalid directory in the library:"
+                       << dir->getAbsPath().toNative();
+            return nullptr;
+          }
+
+          // load the library element
+          std::unique_ptr<ElementType> element(
+              new ElementType(std::move(dir)));  // can throw
+          element->getDirectory().moveToThread(thread);
+          element->moveToThread(thread);
+          return element.release();
+        }));
+  }
+  return futures;
+}
 
-    // load the library element
+template <typename ElementType>
+void ProjectLibrary::finishLoadingElements(
+    QList<QFuture<ElementType*>>& futures, const QString& type,
+    QHash<Uuid, ElementType*>& elementList) {
+  while (!futures.isEmpty()) {
     QScopedPointer<ElementType> element(
-        new ElementType(std::move(dir)));  // can throw
+        futures.takeFirst().result());  // can throw
+    if (!element) {
+      continue;  // invalid directory
+    }
     if (elementList.contains(element->getUuid())) {
       throw RuntimeError(
           __FILE__, __LINE__,
           QString("There are multiple library elements with the same "
                   "UUID in the directory \"%1\"")
-              .arg(dir->getAbsPath().toNative()));
+              .arg(element->getDirectory().getAbsPath().toNative()));
     }
 
     // everything is ok -> update members
@@ -177,6 +220,21 @@ void ProjectLibrary::loadElements(const QString& dirname, const QString& type,
   qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
 }
 
+template <typename ElementType>
+void ProjectLibrary::abortLoadingElements(
+    QList<QFuture<ElementType*>>& futures) noexcept {
+  // wait until all elements are loaded since the worker threads access the
+  // directory, and delete the successfully loaded elements
+  foreach (const QFuture<ElementType*>& future, futures) {
+    try {
+      delete future.result();
+    } catch (...) {
+      // ignore errors
+    }
+  }
+  futures.clear();
+}
+
 template <typename ElementType>
 void ProjectLibrary::addElement(ElementType& element,
                                 QHash<Uuid, ElementType*>& elementList) {
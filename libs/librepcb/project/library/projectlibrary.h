@@ -114,8 +114,14 @@ private:
 
   // Private Methods
   template <typename ElementType>
-  void loadElements(const QString& dirname, const QString& type,
-                    QHash<Uuid, ElementType*>& elementList);
+  QList<QFuture<ElementType*>> startLoadingElements(const QString& dirname);
+  template <typename ElementType>
+  void finishLoadingElements(QList<QFuture<ElementType*>>& futures,
+                             const QString& type,
+                             QHash<Uuid, ElementType*>& elementList);
+  template <typename ElementType>
+  static void abortLoadingElements(
+      QList<QFuture<ElementType*>>& futures) noexcept;
   template <typename ElementType>
   void addElement(ElementType& element, QHash<Uuid, ElementType*>& elementList);
   template <typename ElementType>
@@ -40,6 +40,7 @@
 #include <librepcb/common/font/strokefontpool.h>
 
 #include <QPrinter>
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -107,6 +108,11 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     }
   }
 
+  QElapsedTimer timer;
+  timer.start();
+  QVector<ParseJob> schematicJobs;
+  QVector<ParseJob> boardJobs;
+
   // OK - the project is locked (or read-only) and can be opened!
   // Until this line, there was no memory allocated on the heap. But in the rest
   // of the constructor, a lot of object will be created on the heap. If an
@@ -145,6 +151,16 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
       mProjectMetadata.reset(new ProjectMetadata(root, fileFormat));
     }
 
+    // Start parsing all schematics and boards in worker threads since it
+    // takes some time, but does not depend on any other objects
+    if (!create) {
+      schematicJobs = parseFilesInBackground("schematics/schematics.lp",
+                                             "schematic", "schematic.lp");
+      boardJobs =
+          parseFilesInBackground("boards/boards.lp", "board", "board.lp");
+    }
+    qDebug() << "Loaded metadata in" << timer.restart() << "ms.";
+
     // Create all needed objects
     connect(mProjectMetadata.data(), &ProjectMetadata::attributesChanged, this,
             &Project::attributesChanged);
@@ -152,42 +168,39 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     mProjectLibrary.reset(
         new ProjectLibrary(std::unique_ptr<TransactionalDirectory>(
             new TransactionalDirectory(*mDirectory, "library"))));
+    qDebug() << "Loaded settings and library in" << timer.restart() << "ms.";
     mErcMsgList.reset(new ErcMsgList(*this));
     mCircuit.reset(new Circuit(*this, fileFormat, create));
+    qDebug() << "Loaded circuit in" << timer.restart() << "ms.";
 
     // Load all schematic layers
     mSchematicLayerProvider.reset(new SchematicLayerProvider(*this));
 
     // Load all schematics
+    foreach (const ParseJob& job, schematicJobs) {
+      std::unique_ptr<TransactionalDirectory> dir(
+          new TransactionalDirectory(*mDirectory, job.first));
+      std::shared_ptr<SExpression> root = job.second.result();  // can throw
+      Schematic* schematic =
+          new Schematic(*this, std::move(dir), fileFormat, *root);
+      addSchematic(*schematic);
+    }
     if (!create) {
-      QString fp = "schematics/schematics.lp";
-      SExpression schRoot =
-          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
-      foreach (const SExpression& node, schRoot.getChildren("schematic")) {
-        FilePath fp =
-            FilePath::fromRelative(getPath(), node.getChild("@0").getValue());
-        std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
-            *mDirectory, fp.getParentDir().toRelative(getPath())));
-        Schematic* schematic = new Schematic(*this, std::move(dir), fileFormat);
-        addSchematic(*schematic);
-      }
-      qDebug() << mSchematics.count() << "schematics successfully loaded!";
+      qDebug() << mSchematics.count() << "schematics successfully loaded in"
+               << timer.restart() << "ms!";
     }
 
     // Load all boards
+    foreach (const ParseJob& job, boardJobs) {
+      std::unique_ptr<TransactionalDirectory> dir(
+          new TransactionalDirectory(*mDirectory, job.first));
+      std::shared_ptr<SExpression> root = job.second.result();  // can throw
+      Board* board = new Board(*this, std::move(dir), fileFormat, *root);
+      addBoard(*board);
+    }
     if (!create) {
-      QString fp = "boards/boards.lp";
-      SExpression brdRoot =
-          SExpression::parse(mDirectory->read(fp), mDirectory->getAbsPath(fp));
-      foreach (const SExpression& node, brdRoot.getChildren("board")) {
-        FilePath fp =
-            FilePath::fromRelative(getPath(), node.getChild("@0").getValue());
-        std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
-            *mDirectory, fp.getParentDir().toRelative(getPath())));
-        Board* board = new Board(*this, std::move(dir), fileFormat);
-        addBoard(*board);
-      }
-      qDebug() << mBoards.count() << "boards successfully loaded!";
+      qDebug() << mBoards.count() << "boards successfully loaded in"
+               << timer.restart() << "ms!";
     }
 
     // at this point, the whole circuit with all schematics and boards is
@@ -195,9 +208,21 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     // messages. So we can now restore the ignore state of each ERC message from
     // the file.
     mErcMsgList->restoreIgnoreState();  // can throw
+    qDebug() << "Restored ERC messages in" << timer.restart() << "ms.";
 
     if (create) save();  // write all files to file system
   } catch (...) {
+    // wait until all files are parsed since the worker threads access the
+    // project directory
+    foreach (const ParseJob& job, schematicJobs + boardJobs) {
+      try {
+        QFuture<std::shared_ptr<SExpression>> future = job.second;
+        future.waitForFinished();  // can throw
+      } catch (...) {
+        // ignore errors
+      }
+    }
+
     // free the allocated memory in the reverse order of their allocation...
     foreach (Board* board, mBoards) {
       try {
@@ -607,6 +632,40 @@ QString Project::getBuiltInAttributeValue(const QString& key) const noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QVector<Project::ParseJob> Project::parseFilesInBackground(
+    const QString& indexFilePath, const QString& childName,
+    const QString& fileName) const {
+  // first determine all directories to avoid exceptions after starting jobs
+  SExpression index =
+      SExpression::parse(mDirectory->read(indexFilePath),
+                         mDirectory->getAbsPath(indexFilePath));  // can throw
+  QStringList dirs;
+  foreach (const SExpression& node, index.getChildren(childName)) {
+    FilePath fp =
+        FilePath::fromRelative(getPath(), node.getChild("@0").getValue());
+    dirs.append(fp.getParentDir().toRelative(getPath()));
+  }
+
+  // the worker threads only read from the directory, which is safe as long
+  // as nobody writes to it concurrently
+  QVector<ParseJob> jobs;
+  const TransactionalDirectory* directory = mDirectory.get();
+  foreach (const QString& dir, dirs) {
+    QString filePath = dir % "/" % fileName;
+    FilePath absFilePath = mDirectory->getAbsPath(filePath);
+    jobs.append(qMakePair(
+        dir, QtConcurrent::run([directory, filePath, absFilePath]() {
+          return std::make_shared<SExpression>(SExpression::parse(
+              directory->read(filePath), absFilePath));  // can throw
+        })));
+  }
+  return jobs;
+}
+
 /*******************************************************************************
  *  Static Methods
  ******************************************************************************/
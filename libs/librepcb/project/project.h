@@ -34,6 +34,8 @@
 
 #include <QtCore>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -41,6 +43,7 @@ class QPrinter;
 
 namespace librepcb {
 
+class SExpression;
 class StrokeFontPool;
 
 namespace project {
@@ -462,6 +465,25 @@ private:
   explicit Project(std::unique_ptr<TransactionalDirectory> directory,
                    const QString& filename, bool create);
 
+  /// Directory (relative to the project) and parse result of a file
+  typedef QPair<QString, QFuture<std::shared_ptr<SExpression>>> ParseJob;
+
+  /**
+   * @brief Start parsing all files referenced by an index file in worker
+   *        threads
+   *
+   * @param indexFilePath   Path to the index file (e.g. "boards/boards.lp").
+   * @param childName       Name of the index file entries (e.g. "board").
+   * @param fileName        Name of the files to parse (e.g. "board.lp").
+   *
+   * @return  The parse jobs in the order of the index file
+   *
+   * @throw Exception     If the index file could not be parsed.
+   */
+  QVector<ParseJob> parseFilesInBackground(const QString& indexFilePath,
+                                           const QString& childName,
+                                           const QString& fileName) const;
+
   std::unique_ptr<TransactionalDirectory> mDirectory;
   QString mFilename;  ///< the name of the *.lpp project file
 
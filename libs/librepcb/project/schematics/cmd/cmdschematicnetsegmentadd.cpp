@@ -56,6 +56,15 @@ CmdSchematicNetSegmentAdd::CmdSchematicNetSegmentAdd(
 CmdSchematicNetSegmentAdd::~CmdSchematicNetSegmentAdd() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdSchematicNetSegmentAdd::getApproximateMemoryUsage() const noexcept {
+  return UndoCommand::getApproximateMemoryUsage() +
+      (mNetSegment ? mNetSegment->getApproximateMemoryUsage() : 0);
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -54,6 +54,7 @@ public:
 
   // Getters
   SI_NetSegment* getNetSegment() const noexcept { return mNetSegment; }
+  qint64 getApproximateMemoryUsage() const noexcept override;
 
 private:
   // Private Methods
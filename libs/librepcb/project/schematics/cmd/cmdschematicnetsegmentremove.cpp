@@ -47,6 +47,16 @@ CmdSchematicNetSegmentRemove::CmdSchematicNetSegmentRemove(
 CmdSchematicNetSegmentRemove::~CmdSchematicNetSegmentRemove() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdSchematicNetSegmentRemove::getApproximateMemoryUsage() const
+    noexcept {
+  return UndoCommand::getApproximateMemoryUsage() +
+      mNetSegment.getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -49,6 +49,9 @@ public:
   explicit CmdSchematicNetSegmentRemove(SI_NetSegment& segment) noexcept;
   ~CmdSchematicNetSegmentRemove() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
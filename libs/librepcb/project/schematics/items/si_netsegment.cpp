@@ -73,6 +73,7 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node,
                 .arg(netpoint->getUuid().toStr()));
       }
       mNetPoints.append(netpoint);
+      mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
     }
 
     // Load all netlines
@@ -86,6 +87,7 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node,
                 .arg(netline->getUuid().toStr()));
       }
       mNetLines.append(netline);
+      mNetLinesByUuid.insert(netline->getUuid(), netline);
     }
 
     // Load all netlabels
@@ -99,6 +101,7 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node,
                 .arg(netlabel->getUuid().toStr()));
       }
       mNetLabels.append(netlabel);
+      mNetLabelsByUuid.insert(netlabel->getUuid(), netlabel);
     }
 
     if (!areAllNetPointsConnectedTogether()) {
@@ -113,10 +116,13 @@ SI_NetSegment::SI_NetSegment(Schematic& schematic, const SExpression& node,
     // free the allocated memory in the reverse order of their allocation...
     qDeleteAll(mNetLabels);
     mNetLabels.clear();
+    mNetLabelsByUuid.clear();
     qDeleteAll(mNetLines);
     mNetLines.clear();
+    mNetLinesByUuid.clear();
     qDeleteAll(mNetPoints);
     mNetPoints.clear();
+    mNetPointsByUuid.clear();
     throw;  // ...and rethrow the exception
   }
 }
@@ -129,10 +135,13 @@ SI_NetSegment::~SI_NetSegment() noexcept {
   // delete all items
   qDeleteAll(mNetLabels);
   mNetLabels.clear();
+  mNetLabelsByUuid.clear();
   qDeleteAll(mNetLines);
   mNetLines.clear();
+  mNetLinesByUuid.clear();
   qDeleteAll(mNetPoints);
   mNetPoints.clear();
+  mNetPointsByUuid.clear();
 }
 
 /*******************************************************************************
@@ -144,6 +153,12 @@ bool SI_NetSegment::isUsed() const noexcept {
           (!mNetLabels.isEmpty()));
 }
 
+qint64 SI_NetSegment::getApproximateMemoryUsage() const noexcept {
+  return sizeof(SI_NetSegment) + mNetPoints.count() * sizeof(SI_NetPoint) +
+      mNetLines.count() * sizeof(SI_NetLine) +
+      mNetLabels.count() * sizeof(SI_NetLabel);
+}
+
 int SI_NetSegment::getNetPointsAtScenePos(const Point& pos,
                                           QList<SI_NetPoint*>& points) const
     noexcept {
@@ -270,10 +285,7 @@ void SI_NetSegment::setNetSignal(NetSignal& netsignal) {
  ******************************************************************************/
 
 SI_NetPoint* SI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept {
-  foreach (SI_NetPoint* netpoint, mNetPoints) {
-    if (netpoint->getUuid() == uuid) return netpoint;
-  }
-  return nullptr;
+  return mNetPointsByUuid.value(uuid, nullptr);
 }
 
 /*******************************************************************************
@@ -281,10 +293,7 @@ SI_NetPoint* SI_NetSegment::getNetPointByUuid(const Uuid& uuid) const noexcept {
  ******************************************************************************/
 
 SI_NetLine* SI_NetSegment::getNetLineByUuid(const Uuid& uuid) const noexcept {
-  foreach (SI_NetLine* netline, mNetLines) {
-    if (netline->getUuid() == uuid) return netline;
-  }
-  return nullptr;
+  return mNetLinesByUuid.value(uuid, nullptr);
 }
 
 /*******************************************************************************
@@ -299,7 +308,7 @@ void SI_NetSegment::addNetPointsAndNetLines(
 
   ScopeGuardList sgl(netpoints.count() + netlines.count());
   foreach (SI_NetPoint* netpoint, netpoints) {
-    if ((mNetPoints.contains(netpoint)) ||
+    if ((getNetPointByUuid(netpoint->getUuid()) == netpoint) ||
         (&netpoint->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
@@ -313,13 +322,16 @@ void SI_NetSegment::addNetPointsAndNetLines(
     // add to schematic
     netpoint->addToSchematic();  // can throw
     mNetPoints.append(netpoint);
+    mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
     sgl.add([this, netpoint]() {
       netpoint->removeFromSchematic();
       mNetPoints.removeOne(netpoint);
+      mNetPointsByUuid.remove(netpoint->getUuid());
     });
   }
   foreach (SI_NetLine* netline, netlines) {
-    if ((mNetLines.contains(netline)) || (&netline->getNetSegment() != this)) {
+    if ((getNetLineByUuid(netline->getUuid()) == netline) ||
+        (&netline->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no netline with the same uuid in the list
@@ -332,9 +344,11 @@ void SI_NetSegment::addNetPointsAndNetLines(
     // add to schematic
     netline->addToSchematic();  // can throw
     mNetLines.append(netline);
+    mNetLinesByUuid.insert(netline->getUuid(), netline);
     sgl.add([this, netline]() {
       netline->removeFromSchematic();
       mNetLines.removeOne(netline);
+      mNetLinesByUuid.remove(netline->getUuid());
     });
   }
 
@@ -358,30 +372,40 @@ void SI_NetSegment::removeNetPointsAndNetLines(
 
   ScopeGuardList sgl(netpoints.count() + netlines.count());
   foreach (SI_NetLine* netline, netlines) {
-    if (!mNetLines.contains(netline)) {
+    if (getNetLineByUuid(netline->getUuid()) != netline) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netline->removeFromSchematic();  // can throw
-    mNetLines.removeOne(netline);
+    mNetLinesByUuid.remove(netline->getUuid());
     sgl.add([this, netline]() {
       netline->addToSchematic();
-      mNetLines.append(netline);
+      mNetLinesByUuid.insert(netline->getUuid(), netline);
     });
   }
   foreach (SI_NetPoint* netpoint, netpoints) {
-    if (!mNetPoints.contains(netpoint)) {
+    if (getNetPointByUuid(netpoint->getUuid()) != netpoint) {
       throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netpoint->removeFromSchematic();  // can throw
-    mNetPoints.removeOne(netpoint);
+    mNetPointsByUuid.remove(netpoint->getUuid());
     sgl.add([this, netpoint]() {
       netpoint->addToSchematic();
-      mNetPoints.append(netpoint);
+      mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
     });
   }
 
+  // update the lists at once to avoid quadratic complexity for many items
+  QList<SI_NetPoint*> oldNetPoints = mNetPoints;
+  QList<SI_NetLine*> oldNetLines = mNetLines;
+  Toolbox::removeUnindexedItems(mNetPoints, mNetPointsByUuid);
+  Toolbox::removeUnindexedItems(mNetLines, mNetLinesByUuid);
+  sgl.add([this, oldNetPoints, oldNetLines]() {
+    mNetPoints = oldNetPoints;
+    mNetLines = oldNetLines;
+  });
+
   if (!areAllNetPointsConnectedTogether()) {
     throw LogicError(
         __FILE__, __LINE__,
@@ -399,14 +423,12 @@ void SI_NetSegment::removeNetPointsAndNetLines(
  ******************************************************************************/
 
 SI_NetLabel* SI_NetSegment::getNetLabelByUuid(const Uuid& uuid) const noexcept {
-  foreach (SI_NetLabel* netlabel, mNetLabels) {
-    if (netlabel->getUuid() == uuid) return netlabel;
-  }
-  return nullptr;
+  return mNetLabelsByUuid.value(uuid, nullptr);
 }
 
 void SI_NetSegment::addNetLabel(SI_NetLabel& netlabel) {
-  if ((!isAddedToSchematic()) || (mNetLabels.contains(&netlabel)) ||
+  if ((!isAddedToSchematic()) ||
+      (getNetLabelByUuid(netlabel.getUuid()) == &netlabel) ||
       (&netlabel.getNetSegment() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -420,15 +442,18 @@ void SI_NetSegment::addNetLabel(SI_NetLabel& netlabel) {
   // add to schematic
   netlabel.addToSchematic();  // can throw
   mNetLabels.append(&netlabel);
+  mNetLabelsByUuid.insert(netlabel.getUuid(), &netlabel);
 }
 
 void SI_NetSegment::removeNetLabel(SI_NetLabel& netlabel) {
-  if ((!isAddedToSchematic()) || (!mNetLabels.contains(&netlabel))) {
+  if ((!isAddedToSchematic()) ||
+      (getNetLabelByUuid(netlabel.getUuid()) != &netlabel)) {
     throw LogicError(__FILE__, __LINE__);
   }
   // remove from schematic
   netlabel.removeFromSchematic();  // can throw
   mNetLabels.removeOne(&netlabel);
+  mNetLabelsByUuid.remove(netlabel.getUuid());
 }
 
 void SI_NetSegment::updateAllNetLabelAnchors() noexcept {
@@ -561,44 +586,46 @@ bool SI_NetSegment::checkAttributesValidity() const noexcept {
 bool SI_NetSegment::areAllNetPointsConnectedTogether() const noexcept {
   if (mNetPoints.count() > 1) {
     const SI_NetPoint* firstPoint = mNetPoints.first();
-    QSet<const SI_SymbolPin*> pins;
-    QSet<const SI_NetPoint*> points;
-    findAllConnectedNetPoints(*firstPoint, pins, points);
-    return (points.count() == mNetPoints.count());
+    QSet<const SI_NetLineAnchor*> anchors =
+        findAllConnectedNetLineAnchors(*firstPoint);
+    foreach (const SI_NetPoint* netpoint, mNetPoints) {
+      if (!anchors.contains(netpoint)) return false;
+    }
+    return true;
   } else {
     return true;  // there is only 0 or 1 netpoint => must be "connected
                   // together" :)
   }
 }
 
-void SI_NetSegment::findAllConnectedNetPoints(
-    const SI_NetLineAnchor& p, QSet<const SI_SymbolPin*>& pins,
-    QSet<const SI_NetPoint*>& points) const noexcept {
-  if (const SI_SymbolPin* pin = dynamic_cast<const SI_SymbolPin*>(&p)) {
-    if (pins.contains(pin)) return;
-    pins.insert(pin);
-    foreach (const SI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == pin) {
-        findAllConnectedNetPoints(netline->getEndPoint(), pins, points);
-      }
-      if (&netline->getEndPoint() == pin) {
-        findAllConnectedNetPoints(netline->getStartPoint(), pins, points);
-      }
-    }
-  } else if (const SI_NetPoint* np = dynamic_cast<const SI_NetPoint*>(&p)) {
-    if (points.contains(np)) return;
-    points.insert(np);
-    foreach (const SI_NetLine* netline, mNetLines) {
-      if (&netline->getStartPoint() == np) {
-        findAllConnectedNetPoints(netline->getEndPoint(), pins, points);
-      }
-      if (&netline->getEndPoint() == np) {
-        findAllConnectedNetPoints(netline->getStartPoint(), pins, points);
+QSet<const SI_NetLineAnchor*> SI_NetSegment::findAllConnectedNetLineAnchors(
+    const SI_NetLineAnchor& start) const noexcept {
+  // build adjacency list of all anchors within this segment
+  QHash<const SI_NetLineAnchor*, QVector<const SI_NetLineAnchor*>> adjacency;
+  adjacency.reserve(mNetPoints.count() + mNetLines.count());
+  foreach (const SI_NetLine* netline, mNetLines) {
+    const SI_NetLineAnchor* p1 = &netline->getStartPoint();
+    const SI_NetLineAnchor* p2 = &netline->getEndPoint();
+    adjacency[p1].append(p2);
+    adjacency[p2].append(p1);
+  }
+
+  // iterative depth-first search to not overflow the stack on long wires
+  QSet<const SI_NetLineAnchor*> visited;
+  visited.reserve(adjacency.count() + 1);
+  QVector<const SI_NetLineAnchor*> stack;
+  visited.insert(&start);
+  stack.append(&start);
+  while (!stack.isEmpty()) {
+    const SI_NetLineAnchor* anchor = stack.takeLast();
+    foreach (const SI_NetLineAnchor* neighbor, adjacency.value(anchor)) {
+      if (!visited.contains(neighbor)) {
+        visited.insert(neighbor);
+        stack.append(neighbor);
       }
     }
-  } else {
-    Q_ASSERT(false);
   }
+  return visited;
 }
 
 /*******************************************************************************
@@ -68,6 +68,16 @@ public:
   const Uuid& getUuid() const noexcept { return mUuid; }
   NetSignal& getNetSignal() const noexcept { return *mNetSignal; }
   bool isUsed() const noexcept;
+
+  /**
+   * @brief Get the approximate memory usage of this net segment
+   *
+   * Used to limit the memory of undo commands which hold removed segments.
+   *
+   * @return Approximate memory usage in bytes (including all elements)
+   */
+  qint64 getApproximateMemoryUsage() const noexcept;
+
   int getNetPointsAtScenePos(const Point& pos,
                              QList<SI_NetPoint*>& points) const noexcept;
   int getNetLinesAtScenePos(const Point& pos, QList<SI_NetLine*>& lines) const
@@ -137,10 +147,8 @@ public:
 private:
   bool checkAttributesValidity() const noexcept;
   bool areAllNetPointsConnectedTogether() const noexcept;
-  void findAllConnectedNetPoints(const SI_NetLineAnchor& p,
-                                 QSet<const SI_SymbolPin*>& pins,
-                                 QSet<const SI_NetPoint*>& points) const
-      noexcept;
+  QSet<const SI_NetLineAnchor*> findAllConnectedNetLineAnchors(
+      const SI_NetLineAnchor& start) const noexcept;
 
   // Attributes
   Uuid mUuid;
@@ -150,6 +158,11 @@ private:
   QList<SI_NetPoint*> mNetPoints;
   QList<SI_NetLine*> mNetLines;
   QList<SI_NetLabel*> mNetLabels;
+
+  // Indices for fast lookup by UUID, always in sync with the lists above
+  QHash<Uuid, SI_NetPoint*> mNetPointsByUuid;
+  QHash<Uuid, SI_NetLine*> mNetLinesByUuid;
+  QHash<Uuid, SI_NetLabel*> mNetLabelsByUuid;
 };
 
 /*******************************************************************************
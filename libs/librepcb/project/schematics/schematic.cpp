@@ -56,7 +56,7 @@ namespace project {
 Schematic::Schematic(Project& project,
                      std::unique_ptr<TransactionalDirectory> directory,
                      const Version& fileFormat, bool create,
-                     const QString& newName)
+                     const QString& newName, const SExpression* preparsedRoot)
   : QObject(&project),
     AttributeProvider(),
     mProject(project),
@@ -75,8 +75,12 @@ Schematic::Schematic(Project& project,
       // load default grid properties
       mGridProperties.reset(new GridProperties());
     } else {
-      SExpression root = SExpression::parse(
-          mDirectory->read(getFilePath().getFilename()), getFilePath());
+      SExpression parsedRoot;
+      if (!preparsedRoot) {
+        parsedRoot = SExpression::parse(
+            mDirectory->read(getFilePath().getFilename()), getFilePath());
+      }
+      const SExpression& root = preparsedRoot ? *preparsedRoot : parsedRoot;
 
       // the schematic seems to be ready to open, so we will create all needed
       // objects
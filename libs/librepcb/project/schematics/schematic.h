@@ -119,6 +119,10 @@ public:
   Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory,
             const Version& fileFormat)
     : Schematic(project, std::move(directory), fileFormat, false, QString()) {}
+  Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory,
+            const Version& fileFormat, const SExpression& root)
+    : Schematic(project, std::move(directory), fileFormat, false, QString(),
+                &root) {}
   ~Schematic() noexcept;
 
   // Getters: General
@@ -211,7 +215,8 @@ signals:
 
 private:
   Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory,
-            const Version& fileFormat, bool create, const QString& newName);
+            const Version& fileFormat, bool create, const QString& newName,
+            const SExpression* preparsedRoot = nullptr);
   void updateIcon() noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
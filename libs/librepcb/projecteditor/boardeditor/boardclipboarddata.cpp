@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "boardclipboarddata.h"
 
+#include "../clipboardmimedata.h"
+
 #include <librepcb/common/application.h>
 #include <librepcb/common/fileio/transactionaldirectory.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
@@ -43,7 +45,7 @@ namespace editor {
 
 BoardClipboardData::BoardClipboardData(const Uuid& boardUuid,
                                        const Point& cursorPos) noexcept
-  : mFileSystem(TransactionalFileSystem::openRW(FilePath::getRandomTempPath())),
+  : mFileSystem(createTemporaryFileSystem()),
     mBoardUuid(boardUuid),
     mCursorPos(cursorPos),
     mDevices(),
@@ -61,31 +63,26 @@ BoardClipboardData::BoardClipboardData(const QByteArray& mimeData)
 
   SExpression root =
       SExpression::parse(mFileSystem->read("board.lp"), FilePath());
-  Version fileFormat = qApp->getFileFormatVersion();
-  mBoardUuid = deserialize<Uuid>(root.getChild("board/@0"), fileFormat);
-  mCursorPos = Point(root.getChild("cursor_position"), fileFormat);
-  mDevices.loadFromSExpression(root, fileFormat);
-  mNetSegments.loadFromSExpression(root, fileFormat);
-  mPlanes.loadFromSExpression(root, fileFormat);
-  mPolygons.loadFromSExpression(root, fileFormat);
-  mStrokeTexts.loadFromSExpression(root, fileFormat);
-  mHoles.loadFromSExpression(root, fileFormat);
+  load(root);  // can throw
+}
 
-  foreach (const SExpression& child, root.getChildren("pad_position")) {
-    mPadPositions.insert(
-        std::make_pair(
-            deserialize<Uuid>(child.getChild("device/@0"), fileFormat),
-            deserialize<Uuid>(child.getChild("pad/@0"), fileFormat)),
-        Point(child.getChild("position"), fileFormat));
-  }
+BoardClipboardData::BoardClipboardData(
+    const std::shared_ptr<TransactionalFileSystem>& fileSystem,
+    const SExpression& root)
+  : mFileSystem(fileSystem),
+    mBoardUuid(Uuid::createRandom()),
+    mCursorPos(),
+    mDevices(),
+    mNetSegments(),
+    mPlanes(),
+    mPolygons(),
+    mStrokeTexts(),
+    mHoles(),
+    mPadPositions() {
+  load(root);  // can throw
 }
 
 BoardClipboardData::~BoardClipboardData() noexcept {
-  // Clean up the temporary directory, but destroy the TransactionalFileSystem
-  // object first since it has a lock on the directory.
-  FilePath fp = mFileSystem->getAbsPath();
-  mFileSystem.reset();
-  QDir(fp.toStr()).removeRecursively();
 }
 
 /*******************************************************************************
@@ -98,6 +95,31 @@ std::unique_ptr<TransactionalDirectory> BoardClipboardData::getDirectory(
       new TransactionalDirectory(mFileSystem, path));
 }
 
+qint64 BoardClipboardData::getApproximateMemoryUsage() const noexcept {
+  qint64 usage = sizeof(BoardClipboardData);
+  for (const Device& dev : mDevices) {
+    usage += sizeof(Device) + dev.strokeTexts.count() * sizeof(StrokeText);
+  }
+  for (const NetSegment& seg : mNetSegments) {
+    usage += sizeof(NetSegment) + seg.vias.count() * sizeof(Via) +
+        seg.junctions.count() * sizeof(Junction) +
+        seg.traces.count() * sizeof(Trace);
+  }
+  for (const Plane& plane : mPlanes) {
+    usage +=
+        sizeof(Plane) + plane.outline.getVertices().count() * sizeof(Vertex);
+  }
+  for (const Polygon& polygon : mPolygons) {
+    usage += sizeof(Polygon) +
+        polygon.getPath().getVertices().count() * sizeof(Vertex);
+  }
+  usage += mStrokeTexts.count() * sizeof(StrokeText);
+  usage += mHoles.count() * sizeof(Hole);
+  usage +=
+      mPadPositions.count() * (sizeof(std::pair<Uuid, Uuid>) + sizeof(Point));
+  return usage;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -105,19 +127,20 @@ std::unique_ptr<TransactionalDirectory> BoardClipboardData::getDirectory(
 std::unique_ptr<QMimeData> BoardClipboardData::toMimeData() const {
   SExpression sexpr =
       serializeToDomElement("librepcb_clipboard_board");  // can throw
-  mFileSystem->write("board.lp", sexpr.toByteArray());
-
-  QByteArray zip = mFileSystem->exportToZip();
-
-  std::unique_ptr<QMimeData> data(new QMimeData());
-  data->setData(getMimeType(), zip);
-  data->setData("application/zip", zip);
-  data->setText(sexpr.toByteArray());  // TODO: Remove this
-  return data;
+  return std::unique_ptr<QMimeData>(new ClipboardMimeData(
+      mFileSystem, sexpr, getMimeType(), "board.lp", true));
 }
 
 std::unique_ptr<BoardClipboardData> BoardClipboardData::fromMimeData(
     const QMimeData* mime) {
+  const ClipboardMimeData* data = dynamic_cast<const ClipboardMimeData*>(mime);
+  if (data && (data->getMimeType() == getMimeType())) {
+    // Pasting within the same application instance, so the clipboard content
+    // can be used directly without exporting and importing a ZIP file.
+    return std::unique_ptr<BoardClipboardData>(new BoardClipboardData(
+        data->getFileSystem(), data->getRoot()));  // can throw
+  }
+
   QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
   if (!content.isNull()) {
     return std::unique_ptr<BoardClipboardData>(
@@ -131,6 +154,26 @@ std::unique_ptr<BoardClipboardData> BoardClipboardData::fromMimeData(
  *  Private Methods
  ******************************************************************************/
 
+void BoardClipboardData::load(const SExpression& root) {
+  Version fileFormat = qApp->getFileFormatVersion();
+  mBoardUuid = deserialize<Uuid>(root.getChild("board/@0"), fileFormat);
+  mCursorPos = Point(root.getChild("cursor_position"), fileFormat);
+  mDevices.loadFromSExpression(root, fileFormat);
+  mNetSegments.loadFromSExpression(root, fileFormat);
+  mPlanes.loadFromSExpression(root, fileFormat);
+  mPolygons.loadFromSExpression(root, fileFormat);
+  mStrokeTexts.loadFromSExpression(root, fileFormat);
+  mHoles.loadFromSExpression(root, fileFormat);
+
+  foreach (const SExpression& child, root.getChildren("pad_position")) {
+    mPadPositions.insert(
+        std::make_pair(
+            deserialize<Uuid>(child.getChild("device/@0"), fileFormat),
+            deserialize<Uuid>(child.getChild("pad/@0"), fileFormat)),
+        Point(child.getChild("position"), fileFormat));
+  }
+}
+
 void BoardClipboardData::serialize(SExpression& root) const {
   root.appendChild(mCursorPos.serializeToDomElement("cursor_position"), true);
   root.appendChild("board", mBoardUuid, true);
@@ -151,6 +194,21 @@ void BoardClipboardData::serialize(SExpression& root) const {
   }
 }
 
+std::shared_ptr<TransactionalFileSystem>
+    BoardClipboardData::createTemporaryFileSystem() noexcept {
+  // Clean up the temporary directory as soon as the file system is not used
+  // anymore, but destroy the TransactionalFileSystem object first since it
+  // has a lock on the directory.
+  return std::shared_ptr<TransactionalFileSystem>(
+      new TransactionalFileSystem(FilePath::getRandomTempPath(), true,
+                                  &TransactionalFileSystem::RestoreMode::no),
+      [](TransactionalFileSystem* fs) {
+        FilePath fp = fs->getAbsPath();
+        delete fs;
+        QDir(fp.toStr()).removeRecursively();
+      });
+}
+
 QString BoardClipboardData::getMimeType() noexcept {
   return QString("application/x-librepcb-clipboard.board; version=%1")
       .arg(qApp->applicationVersion());
@@ -250,6 +250,15 @@ public:
     return mPadPositions;
   }
 
+  /**
+   * @brief Get the approximate memory usage of the contained items
+   *
+   * @note The (possibly shared) file system is not taken into account.
+   *
+   * @return Approximate memory usage in bytes
+   */
+  qint64 getApproximateMemoryUsage() const noexcept;
+
   // General Methods
   std::unique_ptr<QMimeData> toMimeData() const;
   static std::unique_ptr<BoardClipboardData> fromMimeData(
@@ -259,13 +268,20 @@ public:
   BoardClipboardData& operator=(const BoardClipboardData& rhs) = delete;
 
 private:  // Methods
+  BoardClipboardData(
+      const std::shared_ptr<TransactionalFileSystem>& fileSystem,
+      const SExpression& root);
+  void load(const SExpression& root);
+
   /// @copydoc ::librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
 
+  static std::shared_ptr<TransactionalFileSystem>
+      createTemporaryFileSystem() noexcept;
   static QString getMimeType() noexcept;
 
 private:  // Data
-  std::shared_ptr<TransactionalFileSystem> mFileSystem;
+  std::shared_ptr<TransactionalFileSystem> mFileSystem;  ///< May be shared
   Uuid mBoardUuid;
   Point mCursorPos;
   SerializableObjectList<Device, Device> mDevices;
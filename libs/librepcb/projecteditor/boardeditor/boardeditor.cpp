@@ -110,6 +110,10 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   mGraphicsView = new GraphicsView(nullptr, this);
   mGraphicsView->setUseOpenGl(
       mProjectEditor.getWorkspace().getSettings().useOpenGl.get());
+  mGraphicsView->setUsePartialViewportUpdates(
+      mProjectEditor.getWorkspace()
+          .getSettings()
+          .usePartialViewportUpdates.get());
   mGraphicsView->setBackgroundBrush(Qt::black);
   mGraphicsView->setForegroundBrush(Qt::white);
   // setCentralWidget(mGraphicsView);
@@ -255,6 +259,16 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
           &StatusBar::setProgressBarPercent, Qt::QueuedConnection);
   connect(mGraphicsView, &GraphicsView::cursorScenePositionChanged,
           mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
+  connect(&mProjectEditor.getUndoStack(), &UndoStack::cleanStateDiscarded,
+          this, [this]() {
+            const UndoStack& stack = mProjectEditor.getUndoStack();
+            mUi->statusbar->showMessage(
+                tr("The undo history limit has been reached (%1 steps, %2 "
+                   "MiB), undo can no longer restore the last saved state.")
+                    .arg(stack.getCommandCount())
+                    .arg(stack.getMemoryUsage() / (1024 * 1024)),
+                10000);
+          });
 
   // Restore Window Geometry
   QSettings clientSettings;
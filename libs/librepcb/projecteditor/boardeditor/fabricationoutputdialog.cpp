@@ -172,6 +172,7 @@ void FabricationOutputDialog::on_btnGenerate_clicked() {
 
     // generate files
     BoardGerberExport grbExport(mBoard, mBoard.getFabricationOutputSettings());
+    grbExport.setParallelExportEnabled(true);
     grbExport.exportAllLayers();
   } catch (Exception& e) {
     QMessageBox::warning(this, tr("Error"), e.getMsg());
@@ -0,0 +1,93 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "clipboardmimedata.h"
+
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ClipboardMimeData::ClipboardMimeData(
+    const std::shared_ptr<TransactionalFileSystem>& fileSystem,
+    const SExpression& root, const QString& mimeType, const QString& fileName,
+    bool withPlainText) noexcept
+  : QMimeData(),
+    mFileSystem(fileSystem),
+    mRoot(root),
+    mMimeType(mimeType),
+    mFileName(fileName),
+    mWithPlainText(withPlainText),
+    mZip() {
+}
+
+ClipboardMimeData::~ClipboardMimeData() noexcept {
+}
+
+/*******************************************************************************
+ *  Inherited from QMimeData
+ ******************************************************************************/
+
+QStringList ClipboardMimeData::formats() const {
+  QStringList formats{mMimeType, "application/zip"};
+  if (mWithPlainText) {
+    formats.append("text/plain");
+  }
+  return formats;
+}
+
+QVariant ClipboardMimeData::retrieveData(const QString& mimeType,
+                                         QVariant::Type type) const {
+  if ((mimeType == mMimeType) || (mimeType == "application/zip")) {
+    if (mZip.isNull()) {
+      try {
+        mFileSystem->write(mFileName, mRoot.toByteArray());  // can throw
+        mZip = mFileSystem->exportToZip();  // can throw
+      } catch (const Exception& e) {
+        qCritical() << "Failed to export clipboard data:" << e.getMsg();
+      }
+    }
+    return mZip;
+  } else if (mWithPlainText && (mimeType == "text/plain")) {
+    return QString(mRoot.toByteArray());  // TODO: Remove this
+  } else {
+    return QMimeData::retrieveData(mimeType, type);
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace project
+}  // namespace librepcb
@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_EDITOR_CLIPBOARDMIMEDATA_H
+#define LIBREPCB_PROJECT_EDITOR_CLIPBOARDMIMEDATA_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/sexpression.h>
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class TransactionalFileSystem;
+
+namespace project {
+namespace editor {
+
+/*******************************************************************************
+ *  Class ClipboardMimeData
+ ******************************************************************************/
+
+/**
+ * @brief Clipboard content which keeps the serialized data in memory
+ *
+ * When pasting within the same application instance, the data is taken
+ * directly from this object (see #getFileSystem() and #getRoot()). The ZIP
+ * file is only created if another process requests the clipboard content.
+ *
+ * @see ::librepcb::project::editor::BoardClipboardData
+ * @see ::librepcb::project::editor::SchematicClipboardData
+ */
+class ClipboardMimeData final : public QMimeData {
+public:
+  // Constructors / Destructor
+  ClipboardMimeData() = delete;
+  ClipboardMimeData(const ClipboardMimeData& other) = delete;
+
+  /**
+   * @brief Constructor
+   *
+   * @param fileSystem    The file system containing all files of the data.
+   * @param root          The serialized data.
+   * @param mimeType      The custom MIME type of the data.
+   * @param fileName      The file name which @p root is written to within
+   *                      the ZIP file.
+   * @param withPlainText If true, @p root is also provided as "text/plain".
+   */
+  ClipboardMimeData(const std::shared_ptr<TransactionalFileSystem>& fileSystem,
+                    const SExpression& root, const QString& mimeType,
+                    const QString& fileName,
+                    bool withPlainText = false) noexcept;
+  ~ClipboardMimeData() noexcept;
+
+  // Getters
+  const std::shared_ptr<TransactionalFileSystem>& getFileSystem() const
+      noexcept {
+    return mFileSystem;
+  }
+  const SExpression& getRoot() const noexcept { return mRoot; }
+  const QString& getMimeType() const noexcept { return mMimeType; }
+
+  // Inherited from QMimeData
+  QStringList formats() const override;
+
+  // Operator Overloadings
+  ClipboardMimeData& operator=(const ClipboardMimeData& rhs) = delete;
+
+protected:  // Methods
+  QVariant retrieveData(const QString& mimeType,
+                        QVariant::Type type) const override;
+
+private:  // Data
+  std::shared_ptr<TransactionalFileSystem> mFileSystem;
+  SExpression mRoot;
+  QString mMimeType;
+  QString mFileName;
+  bool mWithPlainText;
+  mutable QByteArray mZip;  ///< Created on demand
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace project
+}  // namespace librepcb
+
+#endif
@@ -157,6 +157,9 @@ void CmdDragSelectedBoardItems::setCurrentPosition(
   }
 
   if (delta != mDeltaPos) {
+    // Update each netline only once, not for every moved anchor.
+    mBoard.beginDeferredNetLineUpdates();
+
     // move selected elements
     foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
       cmd->translate(delta - mDeltaPos, true);
@@ -180,6 +183,7 @@ void CmdDragSelectedBoardItems::setCurrentPosition(
       cmd->translate(delta - mDeltaPos, true);
     }
     mDeltaPos = delta;
+    mBoard.endDeferredNetLineUpdates();
 
     // Force updating airwires immediately as they are important while moving
     // items.
@@ -191,6 +195,9 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
                                        bool aroundItemsCenter) noexcept {
   Point center = (aroundItemsCenter ? mCenterPos : mStartPos) + mDeltaPos;
 
+  // Update each netline only once, not for every moved anchor.
+  mBoard.beginDeferredNetLineUpdates();
+
   // rotate selected elements
   foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
     cmd->rotate(angle, center, true);
@@ -214,6 +221,7 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
     cmd->rotate(angle, center, true);
   }
   mDeltaAngle += angle;
+  mBoard.endDeferredNetLineUpdates();
 
   // Force updating airwires immediately as they are important while dragging
   // items.
@@ -84,6 +84,15 @@ CmdPasteBoardItems::CmdPasteBoardItems(Board& board,
 CmdPasteBoardItems::~CmdPasteBoardItems() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdPasteBoardItems::getApproximateMemoryUsage() const noexcept {
+  return UndoCommandGroup::getApproximateMemoryUsage() +
+      mData->getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
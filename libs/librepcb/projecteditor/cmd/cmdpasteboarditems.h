@@ -60,6 +60,9 @@ public:
                      const Point& posOffset) noexcept;
   ~CmdPasteBoardItems() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdPasteBoardItems& operator=(const CmdPasteBoardItems& rhs) = delete;
 
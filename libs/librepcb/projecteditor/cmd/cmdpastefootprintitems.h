@@ -66,6 +66,9 @@ public:
       const Point& posOffset) noexcept;
   ~CmdPasteFootprintItems() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdPasteFootprintItems& operator=(const CmdPasteFootprintItems& rhs) = delete;
 
@@ -83,6 +83,15 @@ CmdPasteSchematicItems::CmdPasteSchematicItems(
 CmdPasteSchematicItems::~CmdPasteSchematicItems() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdPasteSchematicItems::getApproximateMemoryUsage() const noexcept {
+  return UndoCommandGroup::getApproximateMemoryUsage() +
+      mData->getApproximateMemoryUsage();
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
@@ -60,6 +60,9 @@ public:
                          const Point& posOffset) noexcept;
   ~CmdPasteSchematicItems() noexcept;
 
+  // Getters
+  qint64 getApproximateMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdPasteSchematicItems& operator=(const CmdPasteSchematicItems& rhs) = delete;
 
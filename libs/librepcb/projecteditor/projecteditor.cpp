@@ -56,6 +56,11 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
     mBoardEditor(nullptr) {
   try {
     mUndoStack = new UndoStack();
+    mUndoStack->setMaxCommandCount(
+        mWorkspace.getSettings().undoStackMaxCommands.get());
+    mUndoStack->setMaxMemoryUsage(
+        qint64(mWorkspace.getSettings().undoStackMaxMemoryMiB.get()) * 1024 *
+        1024);
 
     // create the whole schematic/board editor GUI inclusive FSM and so on
     mSchematicEditor = new SchematicEditor(*this, mProject);
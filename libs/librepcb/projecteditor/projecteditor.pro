@@ -50,6 +50,7 @@ SOURCES += \
     boardeditor/fsm/boardeditorstate_drawtrace.cpp \
     boardeditor/fsm/boardeditorstate_select.cpp \
     boardeditor/unplacedcomponentsdock.cpp \
+    clipboardmimedata.cpp \
     cmd/cmdaddcomponenttocircuit.cpp \
     cmd/cmdadddevicetoboard.cpp \
     cmd/cmdaddsymboltoschematic.cpp \
@@ -125,6 +126,7 @@ HEADERS += \
     boardeditor/fsm/boardeditorstate_drawtrace.h \
     boardeditor/fsm/boardeditorstate_select.h \
     boardeditor/unplacedcomponentsdock.h \
+    clipboardmimedata.h \
     cmd/cmdaddcomponenttocircuit.h \
     cmd/cmdadddevicetoboard.h \
     cmd/cmdaddsymboltoschematic.h \
@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "schematicclipboarddata.h"
 
+#include "../clipboardmimedata.h"
+
 #include <librepcb/common/application.h>
 #include <librepcb/common/fileio/transactionaldirectory.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
@@ -43,7 +45,7 @@ namespace editor {
 
 SchematicClipboardData::SchematicClipboardData(const Uuid& schematicUuid,
                                                const Point& cursorPos) noexcept
-  : mFileSystem(TransactionalFileSystem::openRW(FilePath::getRandomTempPath())),
+  : mFileSystem(createTemporaryFileSystem()),
     mSchematicUuid(schematicUuid),
     mCursorPos(cursorPos),
     mComponentInstances(),
@@ -59,22 +61,24 @@ SchematicClipboardData::SchematicClipboardData(const QByteArray& mimeData)
 
   SExpression root =
       SExpression::parse(mFileSystem->read("schematic.lp"), FilePath());
-  Version fileFormat = qApp->getFileFormatVersion();
-  mSchematicUuid = deserialize<Uuid>(root.getChild("schematic/@0"), fileFormat);
-  mCursorPos = Point(root.getChild("cursor_position"), fileFormat);
-  mComponentInstances.loadFromSExpression(root, fileFormat);
-  mSymbolInstances.loadFromSExpression(root, fileFormat);
-  mNetSegments.loadFromSExpression(root, fileFormat);
-  mPolygons.loadFromSExpression(root, fileFormat);
-  mTexts.loadFromSExpression(root, fileFormat);
+  load(root);  // can throw
+}
+
+SchematicClipboardData::SchematicClipboardData(
+    const std::shared_ptr<TransactionalFileSystem>& fileSystem,
+    const SExpression& root)
+  : mFileSystem(fileSystem),
+    mSchematicUuid(Uuid::createRandom()),
+    mCursorPos(),
+    mComponentInstances(),
+    mSymbolInstances(),
+    mNetSegments(),
+    mPolygons(),
+    mTexts() {
+  load(root);  // can throw
 }
 
 SchematicClipboardData::~SchematicClipboardData() noexcept {
-  // Clean up the temporary directory, but destroy the TransactionalFileSystem
-  // object first since it has a lock on the directory.
-  FilePath fp = mFileSystem->getAbsPath();
-  mFileSystem.reset();
-  QDir(fp.toStr()).removeRecursively();
 }
 
 /*******************************************************************************
@@ -87,6 +91,26 @@ std::unique_ptr<TransactionalDirectory> SchematicClipboardData::getDirectory(
       new TransactionalDirectory(mFileSystem, path));
 }
 
+qint64 SchematicClipboardData::getApproximateMemoryUsage() const noexcept {
+  qint64 usage = sizeof(SchematicClipboardData);
+  for (const ComponentInstance& cmp : mComponentInstances) {
+    usage += sizeof(ComponentInstance) +
+        cmp.attributes.count() * sizeof(Attribute);
+  }
+  usage += mSymbolInstances.count() * sizeof(SymbolInstance);
+  for (const NetSegment& seg : mNetSegments) {
+    usage += sizeof(NetSegment) + seg.junctions.count() * sizeof(Junction) +
+        seg.lines.count() * sizeof(NetLine) +
+        seg.labels.count() * sizeof(NetLabel);
+  }
+  for (const Polygon& polygon : mPolygons) {
+    usage += sizeof(Polygon) +
+        polygon.getPath().getVertices().count() * sizeof(Vertex);
+  }
+  usage += mTexts.count() * sizeof(Text);
+  return usage;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -94,18 +118,20 @@ std::unique_ptr<TransactionalDirectory> SchematicClipboardData::getDirectory(
 std::unique_ptr<QMimeData> SchematicClipboardData::toMimeData() const {
   SExpression sexpr =
       serializeToDomElement("librepcb_clipboard_schematic");  // can throw
-  mFileSystem->write("schematic.lp", sexpr.toByteArray());
-
-  QByteArray zip = mFileSystem->exportToZip();
-
-  std::unique_ptr<QMimeData> data(new QMimeData());
-  data->setData(getMimeType(), zip);
-  data->setData("application/zip", zip);
-  return data;
+  return std::unique_ptr<QMimeData>(new ClipboardMimeData(
+      mFileSystem, sexpr, getMimeType(), "schematic.lp"));
 }
 
 std::unique_ptr<SchematicClipboardData> SchematicClipboardData::fromMimeData(
     const QMimeData* mime) {
+  const ClipboardMimeData* data = dynamic_cast<const ClipboardMimeData*>(mime);
+  if (data && (data->getMimeType() == getMimeType())) {
+    // Pasting within the same application instance, so the clipboard content
+    // can be used directly without exporting and importing a ZIP file.
+    return std::unique_ptr<SchematicClipboardData>(new SchematicClipboardData(
+        data->getFileSystem(), data->getRoot()));  // can throw
+  }
+
   QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
   if (!content.isNull()) {
     return std::unique_ptr<SchematicClipboardData>(
@@ -119,6 +145,17 @@ std::unique_ptr<SchematicClipboardData> SchematicClipboardData::fromMimeData(
  *  Private Methods
  ******************************************************************************/
 
+void SchematicClipboardData::load(const SExpression& root) {
+  Version fileFormat = qApp->getFileFormatVersion();
+  mSchematicUuid = deserialize<Uuid>(root.getChild("schematic/@0"), fileFormat);
+  mCursorPos = Point(root.getChild("cursor_position"), fileFormat);
+  mComponentInstances.loadFromSExpression(root, fileFormat);
+  mSymbolInstances.loadFromSExpression(root, fileFormat);
+  mNetSegments.loadFromSExpression(root, fileFormat);
+  mPolygons.loadFromSExpression(root, fileFormat);
+  mTexts.loadFromSExpression(root, fileFormat);
+}
+
 void SchematicClipboardData::serialize(SExpression& root) const {
   root.appendChild(mCursorPos.serializeToDomElement("cursor_position"), true);
   root.appendChild("schematic", mSchematicUuid, true);
@@ -129,6 +166,21 @@ void SchematicClipboardData::serialize(SExpression& root) const {
   mTexts.serialize(root);
 }
 
+std::shared_ptr<TransactionalFileSystem>
+    SchematicClipboardData::createTemporaryFileSystem() noexcept {
+  // Clean up the temporary directory as soon as the file system is not used
+  // anymore, but destroy the TransactionalFileSystem object first since it
+  // has a lock on the directory.
+  return std::shared_ptr<TransactionalFileSystem>(
+      new TransactionalFileSystem(FilePath::getRandomTempPath(), true,
+                                  &TransactionalFileSystem::RestoreMode::no),
+      [](TransactionalFileSystem* fs) {
+        FilePath fp = fs->getAbsPath();
+        delete fs;
+        QDir(fp.toStr()).removeRecursively();
+      });
+}
+
 QString SchematicClipboardData::getMimeType() noexcept {
   return QString("application/x-librepcb-clipboard.schematic; version=%1")
       .arg(qApp->applicationVersion());
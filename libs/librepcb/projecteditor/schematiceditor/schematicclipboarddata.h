@@ -232,6 +232,15 @@ public:
   PolygonList& getPolygons() noexcept { return mPolygons; }
   TextList& getTexts() noexcept { return mTexts; }
 
+  /**
+   * @brief Get the approximate memory usage of the contained items
+   *
+   * @note The (possibly shared) file system is not taken into account.
+   *
+   * @return Approximate memory usage in bytes
+   */
+  qint64 getApproximateMemoryUsage() const noexcept;
+
   // General Methods
   std::unique_ptr<QMimeData> toMimeData() const;
   static std::unique_ptr<SchematicClipboardData> fromMimeData(
@@ -241,13 +250,20 @@ public:
   SchematicClipboardData& operator=(const SchematicClipboardData& rhs) = delete;
 
 private:  // Methods
+  SchematicClipboardData(
+      const std::shared_ptr<TransactionalFileSystem>& fileSystem,
+      const SExpression& root);
+  void load(const SExpression& root);
+
   /// @copydoc ::librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
 
+  static std::shared_ptr<TransactionalFileSystem>
+      createTemporaryFileSystem() noexcept;
   static QString getMimeType() noexcept;
 
 private:  // Data
-  std::shared_ptr<TransactionalFileSystem> mFileSystem;
+  std::shared_ptr<TransactionalFileSystem> mFileSystem;  ///< May be shared
   Uuid mSchematicUuid;
   Point mCursorPos;
   SerializableObjectList<ComponentInstance, ComponentInstance>
@@ -110,6 +110,10 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
   mGraphicsView = new GraphicsView(nullptr, this);
   mGraphicsView->setUseOpenGl(
       mProjectEditor.getWorkspace().getSettings().useOpenGl.get());
+  mGraphicsView->setUsePartialViewportUpdates(
+      mProjectEditor.getWorkspace()
+          .getSettings()
+          .usePartialViewportUpdates.get());
   setCentralWidget(mGraphicsView);
 
   // Add actions to toggle visibility of dock widgets
@@ -219,6 +223,16 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
           &StatusBar::setProgressBarPercent, Qt::QueuedConnection);
   connect(mGraphicsView, &GraphicsView::cursorScenePositionChanged,
           mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
+  connect(&mProjectEditor.getUndoStack(), &UndoStack::cleanStateDiscarded,
+          this, [this]() {
+            const UndoStack& stack = mProjectEditor.getUndoStack();
+            mUi->statusbar->showMessage(
+                tr("The undo history limit has been reached (%1 steps, %2 "
+                   "MiB), undo can no longer restore the last saved state.")
+                    .arg(stack.getCommandCount())
+                    .arg(stack.getMemoryUsage() / (1024 * 1024)),
+                10000);
+          });
 
   // Make the icons in the components toolbar dependent from project settings
   updateComponentToolbarIcons();
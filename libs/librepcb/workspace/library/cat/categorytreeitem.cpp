@@ -40,56 +40,36 @@ namespace workspace {
 
 template <typename ElementType>
 CategoryTreeItem<ElementType>::CategoryTreeItem(
-    const WorkspaceLibraryDb& library, const QStringList localeOrder,
-    CategoryTreeItem* parent, const tl::optional<Uuid>& uuid,
+    const WorkspaceLibraryDb& library, const QStringList& localeOrder,
     CategoryTreeFilter::Flags filter) noexcept
-  : mParent(parent),
-    mUuid(uuid),
-    mDepth(parent ? parent->getDepth() + 1 : 0),
+  : mParent(nullptr),
+    mRoot(this),
+    mUuid(tl::nullopt),
+    mDepth(0),
+    mChildsLoaded(false),
     mExceptionMessage(),
-    mIsVisible(false) {
+    mFilter(filter) {
   try {
-    if (mUuid) {
-      FilePath fp = getLatestCategory(library);
-      if (fp.isValid()) {
-        library.getElementTranslations<ElementType>(fp, localeOrder, &mName,
-                                                    &mDescription);
-      }
-    }
-
-    if (mUuid || (!mParent)) {
-      QSet<Uuid> childs = getCategoryChilds(library);
-      foreach (const Uuid& childUuid, childs) {
-        ChildType child(new CategoryTreeItem(library, localeOrder, this,
-                                             childUuid, filter));
-        if (child->isVisible()) {
-          mChilds.append(child);
-        }
-      }
-
-      // sort childs
-      std::sort(mChilds.begin(), mChilds.end(),
-                [](const ChildType& a, const ChildType& b) {
-                  return a->data(Qt::DisplayRole) < b->data(Qt::DisplayRole);
-                });
-    }
-
-    if (!mParent) {
-      // add category for elements without category
-      ChildType child(new CategoryTreeItem(library, localeOrder, this,
-                                           tl::nullopt, filter));
-      if (child->isVisible()) {
-        mChilds.append(child);
-      }
-    }
-
-    if ((!mChilds.isEmpty()) || matchesFilter(library, filter)) {
-      mIsVisible = true;
-    }
+    mTree = getCategoryTree(library, localeOrder);  // can throw
   } catch (const Exception& e) {
-    mExceptionMessage = e.getMsg();
-    mIsVisible = true;  // make sure errors are visible
+    qCritical() << "Failed to load the category tree:" << e.getMsg();
+    mExceptionMessage = e.getMsg();  // shown as an error item (see below)
   }
+  updateVisibleCategories();
+  loadChilds();  // the root item is always expanded anyway
+}
+
+template <typename ElementType>
+CategoryTreeItem<ElementType>::CategoryTreeItem(
+    CategoryTreeItem& parent, const tl::optional<Uuid>& uuid,
+    const QString& exceptionMessage) noexcept
+  : mParent(&parent),
+    mRoot(parent.mRoot),
+    mUuid(uuid),
+    mDepth(parent.getDepth() + 1),
+    mChildsLoaded(!exceptionMessage.isEmpty()),  // error items have no childs
+    mExceptionMessage(exceptionMessage),
+    mFilter(parent.mFilter) {
 }
 
 template <typename ElementType>
@@ -114,16 +94,41 @@ int CategoryTreeItem<ElementType>::getChildNumber() const noexcept {
   }
 }
 
+template <typename ElementType>
+bool CategoryTreeItem<ElementType>::hasChilds() const noexcept {
+  if (mChildsLoaded) {
+    return !mChilds.isEmpty();
+  } else {
+    return getChildCountToLoad() > 0;
+  }
+}
+
+template <typename ElementType>
+int CategoryTreeItem<ElementType>::getChildCountToLoad() const noexcept {
+  if (mChildsLoaded) {
+    return 0;
+  } else if ((!mParent) && (!mExceptionMessage.isEmpty())) {
+    return getVisibleChilds().count() + 1;  // including the error item
+  } else {
+    return getVisibleChilds().count();
+  }
+}
+
 template <typename ElementType>
 QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept {
   switch (role) {
-    case Qt::DisplayRole:
-      if (!mUuid)
+    case Qt::DisplayRole: {
+      QString name =
+          mUuid ? mRoot->mTree.names.value(mUuid->toStr()) : QString();
+      if (!mExceptionMessage.isEmpty())
+        return "(ERROR)";
+      else if (!mUuid)
         return "(Without Category)";
-      else if (!mName.isEmpty())
-        return mName;
+      else if (!name.isEmpty())
+        return name;
       else
         return "(ERROR)";
+    }
 
     case Qt::DecorationRole:
       break;
@@ -133,12 +138,12 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept {
 
     case Qt::StatusTipRole:
     case Qt::ToolTipRole:
-      if (!mUuid)
+      if (!mExceptionMessage.isEmpty())
+        return mExceptionMessage;
+      else if (!mUuid)
         return "All library elements without a category";
-      else if (!mDescription.isEmpty())
-        return mDescription;
       else
-        return mExceptionMessage;
+        return mRoot->mTree.descriptions.value(mUuid->toStr());
 
     case Qt::UserRole:
       return mUuid ? mUuid->toStr() : QString();
@@ -149,50 +154,132 @@ QVariant CategoryTreeItem<ElementType>::data(int role) const noexcept {
   return QVariant();
 }
 
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+template <typename ElementType>
+void CategoryTreeItem<ElementType>::loadChilds() noexcept {
+  if (mChildsLoaded) {
+    return;
+  }
+
+  if ((!mParent) && (!mExceptionMessage.isEmpty())) {
+    // make sure errors are visible
+    mChilds.append(
+        ChildType(new CategoryTreeItem(*this, tl::nullopt, mExceptionMessage)));
+  }
+  foreach (const tl::optional<Uuid>& uuid, getVisibleChilds()) {
+    mChilds.append(ChildType(new CategoryTreeItem(*this, uuid)));
+  }
+  mChildsLoaded = true;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-template <>
-FilePath CategoryTreeItem<library::ComponentCategory>::getLatestCategory(
-    const WorkspaceLibraryDb& lib) const {
-  return lib.getLatestComponentCategory(*mUuid);
+template <typename ElementType>
+QList<tl::optional<Uuid>> CategoryTreeItem<ElementType>::getVisibleChilds()
+    const noexcept {
+  QList<tl::optional<Uuid>> childs;
+  if (mUuid || (!mParent)) {
+    QString key = mUuid ? mUuid->toStr() : QString();
+    foreach (const Uuid& childUuid, mRoot->mTree.childs.value(key)) {
+      if (isVisible(childUuid)) {
+        childs.append(childUuid);
+      }
+    }
+
+    // sort childs
+    const QHash<QString, QString>& names = mRoot->mTree.names;
+    std::sort(childs.begin(), childs.end(),
+              [&names](const tl::optional<Uuid>& a,
+                       const tl::optional<Uuid>& b) {
+                return names.value(a->toStr()) < names.value(b->toStr());
+              });
+  }
+
+  if ((!mParent) && isVisible(tl::nullopt)) {
+    // add category for elements without category
+    childs.append(tl::nullopt);
+  }
+  return childs;
 }
 
-template <>
-FilePath CategoryTreeItem<library::PackageCategory>::getLatestCategory(
-    const WorkspaceLibraryDb& lib) const {
-  return lib.getLatestPackageCategory(*mUuid);
+template <typename ElementType>
+bool CategoryTreeItem<ElementType>::isVisible(
+    const tl::optional<Uuid>& uuid) const noexcept {
+  if (mFilter.testFlag(CategoryTreeFilter::ALL)) {
+    return true;
+  } else if (uuid) {
+    return mRoot->mVisibleCategories.contains(uuid->toStr());
+  } else {
+    return matchesFilter(QString());
+  }
+}
+
+template <typename ElementType>
+void CategoryTreeItem<ElementType>::updateVisibleCategories() noexcept {
+  // A category is visible if it matches the filter, or if any of its
+  // (grand-)childs matches the filter. So walk up the hierarchy from each
+  // matching category. Already visited categories are skipped, thus cycles in
+  // the parent-child relationship can't lead to endless loops.
+  QHash<QString, QString> parents;
+  for (auto it = mTree.childs.constBegin(); it != mTree.childs.constEnd();
+       ++it) {
+    foreach (const Uuid& child, it.value()) {
+      parents.insertMulti(child.toStr(), it.key());
+    }
+  }
+  mVisibleCategories.clear();
+  QStringList pending;
+  foreach (const QString& category, mTree.names.keys()) {
+    if (matchesFilter(category)) {
+      pending.append(category);
+    }
+  }
+  while (!pending.isEmpty()) {
+    QString category = pending.takeLast();
+    if (category.isEmpty() || mVisibleCategories.contains(category)) {
+      continue;  // root category or already visited
+    }
+    mVisibleCategories.insert(category);
+    pending.append(parents.values(category));
+  }
 }
 
 template <>
-QSet<Uuid> CategoryTreeItem<library::ComponentCategory>::getCategoryChilds(
-    const WorkspaceLibraryDb& lib) const {
-  return lib.getComponentCategoryChilds(mUuid);
+WorkspaceLibraryDb::CategoryTree
+    CategoryTreeItem<library::ComponentCategory>::getCategoryTree(
+        const WorkspaceLibraryDb& lib, const QStringList& localeOrder) {
+  return lib.getComponentCategoryTree(localeOrder);  // can throw
 }
 
 template <>
-QSet<Uuid> CategoryTreeItem<library::PackageCategory>::getCategoryChilds(
-    const WorkspaceLibraryDb& lib) const {
-  return lib.getPackageCategoryChilds(mUuid);
+WorkspaceLibraryDb::CategoryTree
+    CategoryTreeItem<library::PackageCategory>::getCategoryTree(
+        const WorkspaceLibraryDb& lib, const QStringList& localeOrder) {
+  return lib.getPackageCategoryTree(localeOrder);  // can throw
 }
 
 template <>
 bool CategoryTreeItem<library::ComponentCategory>::matchesFilter(
-    const WorkspaceLibraryDb& lib, CategoryTreeFilter::Flags filter) const {
-  if (filter.testFlag(CategoryTreeFilter::ALL)) {
+    const QString& category) const noexcept {
+  if (mFilter.testFlag(CategoryTreeFilter::ALL)) {
     return true;
   }
-  int categories = 0, symbols = 0, components = 0, devices = 0;
-  lib.getComponentCategoryElementCount(mUuid, &categories, &symbols,
-                                       &components, &devices);
-  if (filter.testFlag(CategoryTreeFilter::SYMBOLS) && (symbols > 0)) {
+  const WorkspaceLibraryDb::CategoryTree& tree = mRoot->mTree;
+  if (mFilter.testFlag(CategoryTreeFilter::SYMBOLS) &&
+      (tree.symbolCounts.value(category) > 0)) {
     return true;
   }
-  if (filter.testFlag(CategoryTreeFilter::COMPONENTS) && (components > 0)) {
+  if (mFilter.testFlag(CategoryTreeFilter::COMPONENTS) &&
+      (tree.componentCounts.value(category) > 0)) {
     return true;
   }
-  if (filter.testFlag(CategoryTreeFilter::DEVICES) && (devices > 0)) {
+  if (mFilter.testFlag(CategoryTreeFilter::DEVICES) &&
+      (tree.deviceCounts.value(category) > 0)) {
     return true;
   }
   return false;
@@ -200,13 +287,13 @@ bool CategoryTreeItem<library::ComponentCategory>::matchesFilter(
 
 template <>
 bool CategoryTreeItem<library::PackageCategory>::matchesFilter(
-    const WorkspaceLibraryDb& lib, CategoryTreeFilter::Flags filter) const {
-  if (filter.testFlag(CategoryTreeFilter::ALL)) {
+    const QString& category) const noexcept {
+  if (mFilter.testFlag(CategoryTreeFilter::ALL)) {
     return true;
   }
-  int categories = 0, packages = 0;
-  lib.getPackageCategoryElementCount(mUuid, &categories, &packages);
-  if (filter.testFlag(CategoryTreeFilter::PACKAGES) && (packages > 0)) {
+  const WorkspaceLibraryDb::CategoryTree& tree = mRoot->mTree;
+  if (mFilter.testFlag(CategoryTreeFilter::PACKAGES) &&
+      (tree.packageCounts.value(category) > 0)) {
     return true;
   }
   return false;
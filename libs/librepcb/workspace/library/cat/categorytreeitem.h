@@ -23,6 +23,8 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../workspacelibrarydb.h"
+
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/uuid.h>
 
@@ -39,8 +41,6 @@ class PackageCategory;
 
 namespace workspace {
 
-class WorkspaceLibraryDb;
-
 /*******************************************************************************
  *  Class CategoryTreeFilter
  ******************************************************************************/
@@ -62,6 +62,11 @@ struct CategoryTreeFilter {
 
 /**
  * @brief The CategoryTreeItem class
+ *
+ * The whole category hierarchy is fetched with a few bulk queries when the
+ * root item gets created. Child items are then created lazily (see
+ * #loadChilds()) when they are needed for the first time, e.g. when a category
+ * gets expanded in a view.
  */
 template <typename ElementType>
 class CategoryTreeItem final {
@@ -70,8 +75,7 @@ public:
   CategoryTreeItem() = delete;
   CategoryTreeItem(const CategoryTreeItem& other) = delete;
   CategoryTreeItem(const WorkspaceLibraryDb& library,
-                   const QStringList localeOrder, CategoryTreeItem* parent,
-                   const tl::optional<Uuid>& uuid,
+                   const QStringList& localeOrder,
                    CategoryTreeFilter::Flags filter) noexcept;
   ~CategoryTreeItem() noexcept;
 
@@ -85,8 +89,19 @@ public:
   }
   int getChildCount() const noexcept { return mChilds.count(); }
   int getChildNumber() const noexcept;
+  bool hasChilds() const noexcept;
+  bool areChildsLoaded() const noexcept { return mChildsLoaded; }
+  int getChildCountToLoad() const noexcept;
   QVariant data(int role) const noexcept;
-  bool isVisible() const noexcept { return mIsVisible; }
+
+  // General Methods
+
+  /**
+   * @brief Create the child items, if not done yet
+   *
+   * Exactly #getChildCountToLoad() childs will be added.
+   */
+  void loadChilds() noexcept;
 
   // Operator Overloadings
   CategoryTreeItem& operator=(const CategoryTreeItem& rhs) = delete;
@@ -95,22 +110,30 @@ private:
   // Types
   using ChildType = QSharedPointer<CategoryTreeItem<ElementType>>;
 
-  // Methods
-  FilePath getLatestCategory(const WorkspaceLibraryDb& lib) const;
-  QSet<Uuid> getCategoryChilds(const WorkspaceLibraryDb& lib) const;
-  bool matchesFilter(const WorkspaceLibraryDb& lib,
-                     CategoryTreeFilter::Flags filter) const;
+  // Private Methods
+  CategoryTreeItem(CategoryTreeItem& parent, const tl::optional<Uuid>& uuid,
+                   const QString& exceptionMessage = QString()) noexcept;
+  QList<tl::optional<Uuid>> getVisibleChilds() const noexcept;
+  bool isVisible(const tl::optional<Uuid>& uuid) const noexcept;
+  void updateVisibleCategories() noexcept;
+  static WorkspaceLibraryDb::CategoryTree getCategoryTree(
+      const WorkspaceLibraryDb& lib, const QStringList& localeOrder);
+  bool matchesFilter(const QString& category) const noexcept;
 
   // Attributes
   CategoryTreeItem* mParent;
+  CategoryTreeItem* mRoot;
   tl::optional<Uuid> mUuid;
-  QString mName;
-  QString mDescription;
   unsigned int mDepth;  ///< this is to avoid endless recursion in the
                         ///< parent-child relationship
-  QString mExceptionMessage;
-  bool mIsVisible;
+  bool mChildsLoaded;
   QList<ChildType> mChilds;
+  QString mExceptionMessage;  ///< Non-empty for the root and its error item
+
+  // Attributes of the root item, shared by all its childs
+  CategoryTreeFilter::Flags mFilter;
+  WorkspaceLibraryDb::CategoryTree mTree;
+  QSet<QString> mVisibleCategories;  ///< Only used without the ALL filter
 };
 
 typedef CategoryTreeItem<library::ComponentCategory> ComponentCategoryTreeItem;
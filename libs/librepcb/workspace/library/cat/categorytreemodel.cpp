@@ -43,8 +43,8 @@ CategoryTreeModel<ElementType>::CategoryTreeModel(
     const WorkspaceLibraryDb& library, const QStringList& localeOrder,
     CategoryTreeFilter::Flags filter) noexcept
   : QAbstractItemModel(nullptr) {
-  mRootItem.reset(new CategoryTreeItem<ElementType>(
-      library, localeOrder, nullptr, tl::nullopt, filter));
+  mRootItem.reset(
+      new CategoryTreeItem<ElementType>(library, localeOrder, filter));
 }
 
 template <typename ElementType>
@@ -83,6 +83,33 @@ int CategoryTreeModel<ElementType>::rowCount(const QModelIndex& parent) const {
   return parentItem->getChildCount();
 }
 
+template <typename ElementType>
+bool CategoryTreeModel<ElementType>::hasChildren(
+    const QModelIndex& parent) const {
+  CategoryTreeItem<ElementType>* parentItem = getItem(parent);
+  return parentItem->hasChilds();
+}
+
+template <typename ElementType>
+bool CategoryTreeModel<ElementType>::canFetchMore(
+    const QModelIndex& parent) const {
+  CategoryTreeItem<ElementType>* parentItem = getItem(parent);
+  return !parentItem->areChildsLoaded();
+}
+
+template <typename ElementType>
+void CategoryTreeModel<ElementType>::fetchMore(const QModelIndex& parent) {
+  CategoryTreeItem<ElementType>* parentItem = getItem(parent);
+  int count = parentItem->getChildCountToLoad();
+  if (count > 0) {
+    beginInsertRows(parent, 0, count - 1);
+    parentItem->loadChilds();
+    endInsertRows();
+  } else {
+    parentItem->loadChilds();
+  }
+}
+
 template <typename ElementType>
 QModelIndex CategoryTreeModel<ElementType>::index(
     int row, int column, const QModelIndex& parent) const {
@@ -277,6 +277,54 @@ QList<FilePath> WorkspaceLibraryDb::getLibraryElements<Device>(
   return getLibraryElements(lib, "devices");  // can throw
 }
 
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata>
+    WorkspaceLibraryDb::getLibraryElementsMetadata<ComponentCategory>(
+        const FilePath& lib, const QStringList& localeOrder) const {
+  return getLibraryElementsMetadata(lib, "component_categories", "cat_id",
+                                    localeOrder);  // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata>
+    WorkspaceLibraryDb::getLibraryElementsMetadata<PackageCategory>(
+        const FilePath& lib, const QStringList& localeOrder) const {
+  return getLibraryElementsMetadata(lib, "package_categories", "cat_id",
+                                    localeOrder);  // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata>
+    WorkspaceLibraryDb::getLibraryElementsMetadata<Symbol>(
+        const FilePath& lib, const QStringList& localeOrder) const {
+  return getLibraryElementsMetadata(lib, "symbols", "symbol_id",
+                                    localeOrder);  // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata>
+    WorkspaceLibraryDb::getLibraryElementsMetadata<Package>(
+        const FilePath& lib, const QStringList& localeOrder) const {
+  return getLibraryElementsMetadata(lib, "packages", "package_id",
+                                    localeOrder);  // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata>
+    WorkspaceLibraryDb::getLibraryElementsMetadata<Component>(
+        const FilePath& lib, const QStringList& localeOrder) const {
+  return getLibraryElementsMetadata(lib, "components", "component_id",
+                                    localeOrder);  // can throw
+}
+
+template <>
+QList<WorkspaceLibraryDb::ElementMetadata>
+    WorkspaceLibraryDb::getLibraryElementsMetadata<Device>(
+        const FilePath& lib, const QStringList& localeOrder) const {
+  return getLibraryElementsMetadata(lib, "devices", "device_id",
+                                    localeOrder);  // can throw
+}
+
 /*******************************************************************************
  *  Getters: Element Metadata
  ******************************************************************************/
@@ -509,6 +557,30 @@ QSet<Uuid> WorkspaceLibraryDb::getDevicesOfComponent(
   return elements;
 }
 
+WorkspaceLibraryDb::CategoryTree WorkspaceLibraryDb::getComponentCategoryTree(
+    const QStringList& localeOrder) const {
+  CategoryTree tree;
+  getCategoryTree("component_categories", "cat_id", localeOrder,
+                  tree);  // can throw
+  tree.symbolCounts =
+      getCategoryElementCounts("symbols", "symbol_id");  // can throw
+  tree.componentCounts =
+      getCategoryElementCounts("components", "component_id");  // can throw
+  tree.deviceCounts =
+      getCategoryElementCounts("devices", "device_id");  // can throw
+  return tree;
+}
+
+WorkspaceLibraryDb::CategoryTree WorkspaceLibraryDb::getPackageCategoryTree(
+    const QStringList& localeOrder) const {
+  CategoryTree tree;
+  getCategoryTree("package_categories", "cat_id", localeOrder,
+                  tree);  // can throw
+  tree.packageCounts =
+      getCategoryElementCounts("packages", "package_id");  // can throw
+  return tree;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -677,6 +749,92 @@ int WorkspaceLibraryDb::getCategoryElementCount(
   return mDb->count(query);
 }
 
+void WorkspaceLibraryDb::getCategoryTree(const QString& tablename,
+                                         const QString& idrowname,
+                                         const QStringList& localeOrder,
+                                         CategoryTree& tree) const {
+  // Note: The rows are ordered by category, so all translations of a category
+  // are returned in consecutive rows.
+  QSqlQuery query = mDb->prepareQuery(
+      "SELECT " % tablename % ".id, uuid, version, parent_uuid, locale, " %
+      "name, description FROM " % tablename % " LEFT JOIN " % tablename %
+      "_tr ON " % tablename % ".id=" % tablename % "_tr." % idrowname %
+      " ORDER BY " % tablename % ".id");
+  mDb->exec(query);  // can throw
+
+  // the names and descriptions are taken from the latest version
+  QHash<QString, Version> versions;
+  QString uuid;  // current category
+  tl::optional<Version> version;  // current category
+  LocalizedNameMap nameMap(ElementName("unknown"));
+  LocalizedDescriptionMap descriptionMap("unknown");
+  auto finishCategory = [&]() {
+    auto it = versions.find(uuid);
+    if (version && ((it == versions.end()) || (*version > *it))) {
+      versions.insert(uuid, *version);
+      tree.names.insert(uuid, *nameMap.value(localeOrder));
+      tree.descriptions.insert(uuid, descriptionMap.value(localeOrder));
+    }
+  };
+  // Note: Invalid rows (e.g. from a corrupt database or a library with invalid
+  // files) are skipped to not lose the whole tree because of a single error.
+  int currentId = -1;
+  while (query.next()) {
+    int id = query.value(0).toInt();
+    if (id != currentId) {
+      finishCategory();
+      currentId = id;
+      version = tl::nullopt;
+      nameMap = LocalizedNameMap(ElementName("unknown"));
+      descriptionMap = LocalizedDescriptionMap("unknown");
+      try {
+        Uuid uuidObj =
+            Uuid::fromString(query.value(1).toString());  // can throw
+        version = Version::fromString(query.value(2).toString());  // can throw
+        uuid = uuidObj.toStr();
+        QVariant parent = query.value(3);
+        tree.childs[parent.isNull() ? QString() : parent.toString()].insert(
+            uuidObj);
+      } catch (const Exception& e) {
+        qWarning() << "Skipped invalid category in library database:"
+                   << e.getMsg();
+      }
+    }
+    if (!version) continue;  // invalid category
+    QString locale = query.value(4).toString();
+    QString name = query.value(5).toString();
+    QString description = query.value(6).toString();
+    if (locale.isNull()) continue;  // no translations at all
+    if (!name.isNull()) {
+      try {
+        nameMap.insert(locale, ElementName(name));  // can throw
+      } catch (const Exception& e) {
+        qWarning() << "Skipped invalid category name in library database:"
+                   << e.getMsg();
+      }
+    }
+    if (!description.isNull()) descriptionMap.insert(locale, description);
+  }
+  finishCategory();
+}
+
+QHash<QString, int> WorkspaceLibraryDb::getCategoryElementCounts(
+    const QString& tablename, const QString& idrowname) const {
+  QSqlQuery query = mDb->prepareQuery(
+      "SELECT category_uuid, COUNT(*) FROM " % tablename % " LEFT JOIN " %
+      tablename % "_cat ON " % tablename % ".id=" % tablename % "_cat." %
+      idrowname % " GROUP BY category_uuid");
+  mDb->exec(query);  // can throw
+
+  QHash<QString, int> counts;
+  while (query.next()) {
+    QVariant category = query.value(0);
+    counts.insert(category.isNull() ? QString() : category.toString(),
+                  query.value(1).toInt());
+  }
+  return counts;
+}
+
 QSet<Uuid> WorkspaceLibraryDb::getElementsByCategory(
     const QString& tablename, const QString& idrowname,
     const tl::optional<Uuid>& categoryUuid) const {
@@ -761,6 +919,56 @@ QList<FilePath> WorkspaceLibraryDb::getLibraryElements(
   return elements;
 }
 
+QList<WorkspaceLibraryDb::ElementMetadata>
+    WorkspaceLibraryDb::getLibraryElementsMetadata(
+        const FilePath& lib, const QString& tablename, const QString& idRow,
+        const QStringList& localeOrder) const {
+  // Note: The rows are ordered by element, so all translations of an element
+  // are returned in consecutive rows.
+  QSqlQuery query = mDb->prepareQuery(
+      "SELECT " % tablename % ".id, filepath, uuid, version, locale, name " %
+      "FROM " % tablename % " LEFT JOIN " % tablename % "_tr ON " %
+      tablename % ".id=" % tablename % "_tr." % idRow %
+      " WHERE lib_id = :lib_id ORDER BY " % tablename % ".id");
+  query.bindValue(":lib_id", getLibraryId(lib));  // can throw
+  mDb->exec(query);  // can throw
+
+  QList<ElementMetadata> elements;
+  int currentId = -1;
+  LocalizedNameMap nameMap(ElementName("unknown"));
+  auto finishElement = [&]() {
+    if (!elements.isEmpty()) {
+      elements.last().name = *nameMap.value(localeOrder);
+    }
+  };
+  while (query.next()) {
+    int id = query.value(0).toInt();
+    if ((elements.isEmpty()) || (id != currentId)) {
+      finishElement();
+      FilePath filepath(FilePath::fromRelative(mWorkspace.getLibrariesPath(),
+                                               query.value(1).toString()));
+      if (!filepath.isValid()) {
+        throw LogicError(__FILE__, __LINE__);
+      }
+      elements.append(ElementMetadata{
+          filepath,
+          Uuid::fromString(query.value(2).toString()),  // can throw
+          Version::fromString(query.value(3).toString()),  // can throw
+          QString(),
+      });
+      currentId = id;
+      nameMap = LocalizedNameMap(ElementName("unknown"));
+    }
+    QString locale = query.value(4).toString();
+    QString name = query.value(5).toString();
+    if ((!locale.isNull()) && (!name.isNull())) {
+      nameMap.insert(locale, ElementName(name));  // can throw
+    }
+  }
+  finishElement();
+  return elements;
+}
+
 void WorkspaceLibraryDb::createAllTables() {
   QStringList queries;
 
@@ -26,6 +26,7 @@
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/uuid.h>
+#include <librepcb/common/version.h>
 
 #include <QtCore>
 
@@ -53,6 +54,36 @@ class WorkspaceLibraryDb final : public QObject {
   Q_OBJECT
 
 public:
+  // Types
+
+  /**
+   * @brief Metadata of a library element as returned by
+   *        #getLibraryElementsMetadata()
+   */
+  struct ElementMetadata {
+    FilePath filePath;  ///< Absolute path to the element directory
+    Uuid uuid;
+    Version version;
+    QString name;  ///< Name in the best matching locale
+  };
+
+  /**
+   * @brief The complete hierarchy of all categories of one type, as returned
+   *        by #getComponentCategoryTree() and #getPackageCategoryTree()
+   *
+   * All hashes are keyed by the category UUID as string. The (virtual) root
+   * category, i.e. no category at all, is represented by an empty string.
+   */
+  struct CategoryTree {
+    QHash<QString, QString> names;  ///< Names of the latest versions
+    QHash<QString, QString> descriptions;  ///< Descr. of the latest versions
+    QHash<QString, QSet<Uuid>> childs;  ///< Child categories of a category
+    QHash<QString, int> symbolCounts;  ///< Number of symbols per category
+    QHash<QString, int> packageCounts;  ///< Number of packages per category
+    QHash<QString, int> componentCounts;  ///< Number of cmp. per category
+    QHash<QString, int> deviceCounts;  ///< Number of devices per category
+  };
+
   // Constructors / Destructor
   WorkspaceLibraryDb() = delete;
   WorkspaceLibraryDb(const WorkspaceLibraryDb& other) = delete;
@@ -100,6 +131,22 @@ public:
   template <typename ElementType>
   QList<FilePath> getLibraryElements(const FilePath& lib) const;
 
+  /**
+   * @brief Get the metadata of all elements of a library at once
+   *
+   * This is much faster than calling #getElementTranslations() and
+   * #getElementMetadata() for every element returned by
+   * #getLibraryElements() since it needs only a single database query.
+   *
+   * @param lib           The library directory.
+   * @param localeOrder   The locale order used to determine the names.
+   *
+   * @return  Metadata of all elements of the given type in the library
+   */
+  template <typename ElementType>
+  QList<ElementMetadata> getLibraryElementsMetadata(
+      const FilePath& lib, const QStringList& localeOrder) const;
+
   // Getters: Element Metadata
   template <typename ElementType>
   void getElementTranslations(const FilePath& elemDir,
@@ -129,6 +176,29 @@ public:
   QSet<Uuid> getDevicesByCategory(const tl::optional<Uuid>& category) const;
   QSet<Uuid> getDevicesOfComponent(const Uuid& component) const;
 
+  /**
+   * @brief Get the whole component category hierarchy with a few queries
+   *
+   * This is much faster than querying childs, translations and element counts
+   * for each category separately.
+   *
+   * @param localeOrder   The locale order used to determine the names.
+   *
+   * @return  All component categories with symbol, component and device counts
+   */
+  CategoryTree getComponentCategoryTree(const QStringList& localeOrder) const;
+
+  /**
+   * @brief Get the whole package category hierarchy with a few queries
+   *
+   * @param localeOrder   The locale order used to determine the names.
+   *
+   * @return  All package categories with package counts
+   *
+   * @see #getComponentCategoryTree()
+   */
+  CategoryTree getPackageCategoryTree(const QStringList& localeOrder) const;
+
   // General Methods
 
   /**
@@ -171,6 +241,11 @@ private:
   int getCategoryElementCount(const QString& tablename,
                               const QString& idrowname,
                               const tl::optional<Uuid>& category) const;
+  void getCategoryTree(const QString& tablename, const QString& idrowname,
+                       const QStringList& localeOrder,
+                       CategoryTree& tree) const;
+  QHash<QString, int> getCategoryElementCounts(const QString& tablename,
+                                               const QString& idrowname) const;
   QSet<Uuid> getElementsByCategory(
       const QString& tablename, const QString& idrowname,
       const tl::optional<Uuid>& categoryUuid) const;
@@ -180,6 +255,9 @@ private:
   int getLibraryId(const FilePath& lib) const;
   QList<FilePath> getLibraryElements(const FilePath& lib,
                                      const QString& tablename) const;
+  QList<ElementMetadata> getLibraryElementsMetadata(
+      const FilePath& lib, const QString& tablename, const QString& idRow,
+      const QStringList& localeOrder) const;
   void createAllTables();
   void setDbVersion(int version);
   int getDbVersion() const noexcept;
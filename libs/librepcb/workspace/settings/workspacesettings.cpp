@@ -47,7 +47,10 @@ WorkspaceSettings::WorkspaceSettings(const FilePath& fp,
     applicationLocale("application_locale", "", this),
     defaultLengthUnit("default_length_unit", LengthUnit::millimeters(), this),
     projectAutosaveIntervalSeconds("project_autosave_interval", 600U, this),
+    undoStackMaxCommands("undo_stack_max_commands", 1000U, this),
+    undoStackMaxMemoryMiB("undo_stack_max_memory", 256U, this),
     useOpenGl("use_opengl", false, this),
+    usePartialViewportUpdates("use_partial_viewport_updates", false, this),
     libraryLocaleOrder("library_locale_order", "locale", QStringList(), this),
     libraryNormOrder("library_norm_order", "norm", QStringList(), this),
     repositoryUrls("repositories", "repository",
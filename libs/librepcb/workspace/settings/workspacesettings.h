@@ -145,6 +145,24 @@ public:
    */
   WorkspaceSettingsItem_GenericValue<uint> projectAutosaveIntervalSeconds;
 
+  /**
+   * @brief Maximum number of steps in the undo history (0 = unlimited)
+   *
+   * @see librepcb::UndoStack::setMaxCommandCount()
+   *
+   * Default: 1000
+   */
+  WorkspaceSettingsItem_GenericValue<uint> undoStackMaxCommands;
+
+  /**
+   * @brief Maximum memory usage of the undo history [MiB] (0 = unlimited)
+   *
+   * @see librepcb::UndoStack::setMaxMemoryUsage()
+   *
+   * Default: 256
+   */
+  WorkspaceSettingsItem_GenericValue<uint> undoStackMaxMemoryMiB;
+
   /**
    * @brief Use OpenGL hardware acceleration
    *
@@ -152,6 +170,15 @@ public:
    */
   WorkspaceSettingsItem_GenericValue<bool> useOpenGl;
 
+  /**
+   * @brief Repaint only the changed parts of graphics views
+   *
+   * @see librepcb::GraphicsView::setUsePartialViewportUpdates()
+   *
+   * Default: False
+   */
+  WorkspaceSettingsItem_GenericValue<bool> usePartialViewportUpdates;
+
   /**
    * @brief Preferred library locales (like "de_CH") in the right order
    *
@@ -264,9 +264,18 @@ void WorkspaceSettingsDialog::loadSettings() noexcept {
   mUi->spbAutosaveInterval->setValue(
       mSettings.projectAutosaveIntervalSeconds.get());
 
+  // Undo History
+  mUi->spbUndoStackMaxCommands->setValue(
+      mSettings.undoStackMaxCommands.get());
+  mUi->spbUndoStackMaxMemory->setValue(mSettings.undoStackMaxMemoryMiB.get());
+
   // Use OpenGL
   mUi->cbxUseOpenGl->setChecked(mSettings.useOpenGl.get());
 
+  // Use Partial Viewport Updates
+  mUi->cbxUsePartialViewportUpdates->setChecked(
+      mSettings.usePartialViewportUpdates.get());
+
   // Library Locale Order
   mLibLocaleOrderModel->setValues(mSettings.libraryLocaleOrder.get());
 
@@ -309,9 +318,17 @@ void WorkspaceSettingsDialog::saveSettings() noexcept {
     mSettings.projectAutosaveIntervalSeconds.set(
         mUi->spbAutosaveInterval->value());
 
+    // Undo History
+    mSettings.undoStackMaxCommands.set(mUi->spbUndoStackMaxCommands->value());
+    mSettings.undoStackMaxMemoryMiB.set(mUi->spbUndoStackMaxMemory->value());
+
     // Use OpenGL
     mSettings.useOpenGl.set(mUi->cbxUseOpenGl->isChecked());
 
+    // Use Partial Viewport Updates
+    mSettings.usePartialViewportUpdates.set(
+        mUi->cbxUsePartialViewportUpdates->isChecked());
+
     // Library Locale Order
     mSettings.libraryLocaleOrder.set(mLibLocaleOrderModel->getValues());
 
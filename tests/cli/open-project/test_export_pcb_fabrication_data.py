@@ -1,7 +1,9 @@
 #!/usr/bin/env python
 # -*- coding: utf-8 -*-
 
+import math
 import os
+import re
 import fileinput
 import params
 import pytest
@@ -10,6 +12,92 @@ import pytest
 Test command "open-project --export-pcb-fabrication-data"
 """
 
+# Project containing vias, THT pads, traces and planes
+GERBER_TEST_PROJECT_DIR = 'Gerber Test'
+GERBER_TEST_PROJECT_PATH = 'Gerber Test/project.lpp'
+
+GERBER_TEST_SETTINGS = """
+  (fabrication_output_settings
+    (base_path "./OUTPUT_DIR/")
+    (outlines (suffix "OUTLINES.gbr"))
+    (copper_top (suffix "COPPER-TOP.gbr"))
+    (copper_inner (suffix "COPPER-IN{{CU_LAYER}}.gbr"))
+    (copper_bot (suffix "COPPER-BOTTOM.gbr"))
+    (soldermask_top (suffix "SOLDERMASK-TOP.gbr"))
+    (soldermask_bot (suffix "SOLDERMASK-BOTTOM.gbr"))
+    (silkscreen_top (suffix "SILKSCREEN-TOP.gbr")
+      (layers top_placement top_names)
+    )
+    (silkscreen_bot (suffix "SILKSCREEN-BOTTOM.gbr")
+      (layers bot_placement bot_names)
+    )
+    (drills (merge false)
+      (suffix_pth "DRILLS-PTH.drl")
+      (suffix_npth "DRILLS-NPTH.drl")
+      (suffix_merged "DRILLS.drl")
+    )
+    (solderpaste_top (create false) (suffix "SOLDERPASTE-TOP.gbr"))
+    (solderpaste_bot (create false) (suffix "SOLDERPASTE-BOTTOM.gbr"))
+  )
+"""
+
+
+def export_gerber_test_project(cli, output_dir, *options):
+    settings = output_dir + '.lp'
+    with open(cli.abspath(settings), mode='w') as f:
+        f.write(GERBER_TEST_SETTINGS.replace('OUTPUT_DIR', output_dir))
+    code, stdout, stderr = cli.run('open-project',
+                                   '--export-pcb-fabrication-data',
+                                   '--pcb-fabrication-settings=' + settings,
+                                   *(list(options) + [GERBER_TEST_PROJECT_PATH]))
+    assert code == 0
+    assert len(stdout) > 0
+    assert stdout[-1] == 'SUCCESS'
+    dir = os.path.join(os.path.dirname(cli.abspath(GERBER_TEST_PROJECT_PATH)),
+                       output_dir)
+    assert os.path.exists(dir)
+    return dir
+
+
+def read_drill_hits(content):
+    hits = []
+    tool = None
+    for line in content.splitlines():
+        if re.match(r'^T\d+$', line):
+            tool = line
+        elif line.startswith('X'):
+            hits.append((tool, line))
+    return hits
+
+
+def calc_travel_distance(hits):
+    distance = 0.0
+    x, y = 0.0, 0.0  # the drill head starts at the origin
+    for _, line in hits:
+        match = re.match(r'^X(-?[\d.]+)Y(-?[\d.]+)$', line)
+        assert match is not None, line
+        next_x, next_y = float(match.group(1)), float(match.group(2))
+        distance += math.hypot(next_x - x, next_y - y)
+        x, y = next_x, next_y
+    return distance
+
+
+def count_flashes(lines):
+    return len([line for line in lines if line.endswith('D03*')])
+
+
+def count_draws_outside_regions(lines):
+    count = 0
+    in_region = False
+    for line in lines:
+        if line == 'G36*':
+            in_region = True
+        elif line == 'G37*':
+            in_region = False
+        elif line.endswith('D01*') and not in_region:
+            count += 1
+    return count
+
 
 @pytest.mark.parametrize("project", [
     params.EMPTY_PROJECT_LPP_PARAM,
@@ -93,6 +181,56 @@ def test_if_exporting_invalid_board_fails(cli, project):
     assert not os.path.exists(dir)
 
 
+def test_export_with_optimized_drill_paths(cli):
+    cli.add_project(GERBER_TEST_PROJECT_DIR)
+    dir = export_gerber_test_project(cli, 'unoptimized')
+    optimized_dir = export_gerber_test_project(cli, 'optimized',
+                                               '--optimize-drill-paths')
+    assert sorted(os.listdir(optimized_dir)) == sorted(os.listdir(dir))
+    total_distance = 0.0
+    total_optimized_distance = 0.0
+    for filename in sorted(os.listdir(dir)):
+        if not filename.endswith('.drl'):
+            continue
+        with open(os.path.join(dir, filename)) as f:
+            hits = read_drill_hits(f.read())
+        with open(os.path.join(optimized_dir, filename)) as f:
+            optimized_hits = read_drill_hits(f.read())
+        # only the order of the hits may change, not the hits themselves
+        assert sorted(optimized_hits) == sorted(hits)
+        distance = calc_travel_distance(hits)
+        optimized_distance = calc_travel_distance(optimized_hits)
+        print('{}: {} hits, travel distance {:.3f}mm before and {:.3f}mm '
+              'after optimization'.format(filename, len(hits), distance,
+                                          optimized_distance))
+        total_distance += distance
+        total_optimized_distance += optimized_distance
+    # the project contains vias and THT pads, so there are plated holes which
+    # are not drilled in the shortest order without optimization
+    with open(os.path.join(dir, 'DRILLS-PTH.drl')) as f:
+        assert len(read_drill_hits(f.read())) > 2
+    assert total_optimized_distance < total_distance
+
+
+def test_export_with_merged_copper_regions(cli):
+    cli.add_project(GERBER_TEST_PROJECT_DIR)
+    dir = export_gerber_test_project(cli, 'separate')
+    merged_dir = export_gerber_test_project(cli, 'merged',
+                                            '--merge-copper-regions')
+    for suffix in ['COPPER-TOP.gbr', 'COPPER-BOTTOM.gbr']:
+        with open(os.path.join(dir, suffix)) as f:
+            separate = f.read().splitlines()
+        with open(os.path.join(merged_dir, suffix)) as f:
+            merged = f.read().splitlines()
+        # pads, vias, traces and planes are exported as regions instead of
+        # flashes and draws
+        assert merged.count('G36*') > 0
+        assert merged.count('G36*') == merged.count('G37*')
+        assert count_flashes(merged) < count_flashes(separate)
+        assert count_draws_outside_regions(merged) <= \
+            count_draws_outside_regions(separate)
+
+
 @pytest.mark.parametrize("project", [
     params.PROJECT_WITH_TWO_BOARDS_LPP_PARAM,
     params.PROJECT_WITH_TWO_BOARDS_LPPZ_PARAM,
@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import json
+import os
+import re
+import params
+import pytest
+
+"""
+Test command "open-project --drc"
+"""
+
+
+def add_hole_to_board(cli, project, x, y, diameter):
+    with open(cli.abspath(project.dir + '/boards/boards.lp'), 'r') as f:
+        board = re.search(r'\(board "([^"]+)"\)', f.read()).group(1)
+    path = cli.abspath(project.dir + '/' + board)
+    with open(path, 'r') as f:
+        content = f.read().rstrip()
+    assert content.endswith(')')
+    hole = '(hole 1b4f8a59-6c4e-4c6e-9d0f-3a7c2e5b8d10 ' \
+           '(diameter {}) (position {} {}))'.format(diameter, x, y)
+    with open(path, 'w') as f:
+        f.write(content[:-1] + ' ' + hole + ')\n')
+
+
+@pytest.mark.parametrize("project", [params.EMPTY_PROJECT_LPP_PARAM])
+def test_if_project_without_boards_succeeds(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+
+    # remove all boards first
+    with open(cli.abspath(project.dir + '/boards/boards.lp'), 'w') as f:
+        f.write('(librepcb_boards)')
+
+    code, stdout, stderr = cli.run('open-project', '--drc', project.path)
+    assert code == 0
+    assert len(stderr) == 0
+    assert 'Run DRC...' in stdout
+    assert stdout[-1] == 'SUCCESS'
+
+
+@pytest.mark.parametrize("project", [
+    params.PROJECT_WITH_TWO_BOARDS_LPP_PARAM,
+    params.PROJECT_WITH_TWO_BOARDS_LPPZ_PARAM,
+])
+def test_report_contains_all_boards(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    json_path = project.output_dir + 'drc.json'
+    csv_path = project.output_dir + 'drc.csv'
+    code, stdout, stderr = cli.run('open-project', '--drc',
+                                   '--drc-report=' + json_path,
+                                   '--drc-report=' + csv_path,
+                                   project.path)
+    assert all(['[DRC]' in line for line in stderr])
+    assert len([l for l in stdout if "Board '" in l]) == project.board_count
+    with open(cli.abspath(json_path), 'r') as f:
+        report = json.load(f)
+    assert len(report['boards']) == project.board_count
+    for board in report['boards']:
+        assert len(board['stages']) > 0
+        assert all([s['duration_ms'] >= 0 for s in board['stages']])
+    message_count = sum([len(b['messages']) for b in report['boards']])
+    assert message_count == len(stderr)
+    assert code == (1 if message_count else 0)
+    with open(cli.abspath(csv_path), 'r') as f:
+        lines = f.read().splitlines()
+    assert len([l for l in lines if l and not l.startswith('#')]) == \
+        message_count + 1  # header + one line per message
+
+
+@pytest.mark.parametrize("project", [params.EMPTY_PROJECT_LPP_PARAM])
+def test_report_contains_violation(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    add_hole_to_board(cli, project, 10.0, 20.0, 0.1)  # below 0.25mm default
+    json_path = project.output_dir + 'drc.json'
+    csv_path = project.output_dir + 'drc.csv'
+    code, stdout, stderr = cli.run('open-project', '--drc',
+                                   '--drc-report=' + json_path,
+                                   '--drc-report=' + csv_path,
+                                   project.path)
+    assert code == 1
+    assert stderr == ['    - [DRC] Min. hole diameter: 0.1mm']
+    with open(cli.abspath(json_path), 'r') as f:
+        report = json.load(f)
+    assert report['settings']['min_npth_drill_diameter'] == 0.25
+    assert len(report['boards']) == 1
+    board = report['boards'][0]
+    assert board['messages'] == [{
+        'message': 'Min. hole diameter: 0.1mm',
+        'locations': [[
+            {'x': 10.05, 'y': 20.0},
+            {'x': 9.95, 'y': 20.0},
+            {'x': 10.05, 'y': 20.0},
+        ]],
+    }]
+    with open(cli.abspath(csv_path), 'r') as f:
+        lines = [l for l in f.read().splitlines() if l and l[0] != '#']
+    assert lines == [
+        'Board,Message,X,Y',
+        '{},Min. hole diameter: 0.1mm,10.0,20.0'.format(board['name']),
+    ]
+
+
+@pytest.mark.parametrize("project", [params.EMPTY_PROJECT_LPP_PARAM])
+def test_custom_settings_are_applied(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    add_hole_to_board(cli, project, 10.0, 20.0, 0.1)
+    with open(cli.abspath('drc.lp'), 'w') as f:
+        f.write('(librepcb_drc_settings (min_npth_drill_diameter 0.05))')
+    json_path = project.output_dir + 'drc.json'
+    code, stdout, stderr = cli.run('open-project', '--drc',
+                                   '--drc-settings=drc.lp',
+                                   '--drc-report=' + json_path,
+                                   project.path)
+    assert code == 0
+    assert len(stderr) == 0
+    with open(cli.abspath(json_path), 'r') as f:
+        report = json.load(f)
+    assert report['settings']['min_npth_drill_diameter'] == 0.05
+    assert report['settings']['min_pth_drill_diameter'] == 0.25  # default
+    assert report['boards'][0]['messages'] == []
+
+
+@pytest.mark.parametrize("project", [params.PROJECT_WITH_TWO_BOARDS_LPP_PARAM])
+def test_report_with_unknown_extension_fails(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    relpath = project.output_dir + 'drc.foo'
+    code, stdout, stderr = cli.run('open-project', '--drc',
+                                   '--drc-report=' + relpath,
+                                   project.path)
+    assert code == 1
+    assert "ERROR: Unknown extension 'foo'." in stderr
+    assert not os.path.exists(cli.abspath(relpath))
+
+
+@pytest.mark.parametrize("project", [params.EMPTY_PROJECT_LPP_PARAM])
+def test_invalid_settings_file_fails(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--drc',
+                                   '--drc-settings=nonexistent.lp',
+                                   project.path)
+    assert code == 1
+    assert any(['Failed to load custom settings' in l for l in stderr])
+
+
+@pytest.mark.parametrize("project", [params.EMPTY_PROJECT_LPP_PARAM])
+def test_invalid_jobs_count_fails(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--drc', '--jobs=0',
+                                   project.path)
+    assert code == 1
+    assert len(stderr) == 1
+    assert "--jobs" in stderr[0]
@@ -28,6 +28,8 @@
 
 #include <QtCore>
 
+#include <iostream>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -43,6 +45,24 @@ typedef struct {
   const QString output;
 } AttributeSubstitutorTestData;
 
+/*******************************************************************************
+ *  Helper Classes
+ ******************************************************************************/
+
+class AttributeProviderMap final : public AttributeProvider {
+public:
+  explicit AttributeProviderMap(const QHash<QString, QString>& values) noexcept
+    : mValues(values) {}
+  QString getUserDefinedAttributeValue(const QString& key) const
+      noexcept override {
+    return mValues.value(key);
+  }
+  void attributesChanged() override {}
+
+private:
+  QHash<QString, QString> mValues;
+};
+
 /*******************************************************************************
  *  Test Class
  ******************************************************************************/
@@ -61,6 +81,98 @@ TEST_P(AttributeSubstitutorTest, testData) {
   QString output = AttributeSubstitutor::substitute(data.input, &ap);
   EXPECT_EQ(data.output, output)
       << "Actual value: '" << qPrintable(output) << "'";
+
+  // substitute again to test the cached template
+  output = AttributeSubstitutor::substitute(data.input, &ap);
+  EXPECT_EQ(data.output, output)
+      << "Actual value: '" << qPrintable(output) << "'";
+}
+
+TEST(AttributeSubstitutorFilterTest, testFilterIsAppliedToEachValue) {
+  AttributeProviderDummy ap;
+  QString output = AttributeSubstitutor::substitute(
+      "A B/{{KEY_1}}/{{ 'x y' }}{{FOO}}", &ap, [](const QString& str) {
+        return QString("<%1>").arg(QString(str).replace(' ', '_'));
+      });
+  EXPECT_EQ("A B/<Normal_value>/<x_y><>", output.toStdString());
+}
+
+TEST(AttributeSubstitutorCacheTest, testSameTemplateWithOtherProviders) {
+  // The compiled template is cached, but the values must always be fetched
+  // from the provider passed to the current call.
+  const QString text = "R1 {{FOO or KEY_1}}!";
+  AttributeProviderDummy ap;
+  EXPECT_EQ("R1 Normal value!",
+            AttributeSubstitutor::substitute(text, &ap).toStdString());
+
+  AttributeProviderMap other({{"KEY_1", "Other value"}});
+  EXPECT_EQ("R1 Other value!",
+            AttributeSubstitutor::substitute(text, &other).toStdString());
+
+  AttributeProviderMap fallback({{"FOO", "Foo"}, {"KEY_1", "Unused"}});
+  EXPECT_EQ("R1 Foo!",
+            AttributeSubstitutor::substitute(text, &fallback).toStdString());
+
+  EXPECT_EQ("R1 !",
+            AttributeSubstitutor::substitute(text, nullptr).toStdString());
+  EXPECT_EQ("R1 Normal value!",
+            AttributeSubstitutor::substitute(text, &ap).toStdString());
+}
+
+TEST(AttributeSubstitutorCacheTest, testValuesContainingVariables) {
+  // Values containing "{{" must not be taken over literally from the cached
+  // template, but be substituted recursively.
+  const QString text = "{{KEY_1}}";
+  AttributeProviderMap nested({{"KEY_1", "A {{KEY_2}} B"}, {"KEY_2", "x"}});
+  EXPECT_EQ("A x B",
+            AttributeSubstitutor::substitute(text, &nested).toStdString());
+
+  AttributeProviderMap unclosed({{"KEY_1", "Open {{ brace"}});
+  EXPECT_EQ("Open {{ brace",
+            AttributeSubstitutor::substitute(text, &unclosed).toStdString());
+
+  AttributeProviderMap escaped({{"KEY_1", "{{ '{{' }}x"}});
+  EXPECT_EQ("{{x",
+            AttributeSubstitutor::substitute(text, &escaped).toStdString());
+}
+
+TEST(AttributeSubstitutorPerformanceTest, testColdVsCachedTemplates) {
+  // Similar to a large board: each device has a NAME and a VALUE text. The
+  // texts are made unique to measure compiling the templates (cold) and
+  // evaluating the already compiled templates (cached) separately.
+  const int count = 2000;
+  QVector<std::shared_ptr<AttributeProviderMap>> providers;
+  QStringList texts;
+  for (int i = 0; i < count; ++i) {
+    providers.append(std::make_shared<AttributeProviderMap>(
+        QHash<QString, QString>{{"NAME", QString("R%1").arg(i)},
+                                {"VALUE", QString("%1k").arg(i)}}));
+    texts.append(QString("{{NAME}} #%1").arg(i));
+    texts.append(QString("{{VALUE}} #%1").arg(i));
+  }
+
+  auto substituteAll = [&]() -> QStringList {
+    QStringList results;
+    for (int i = 0; i < texts.count(); ++i) {
+      const AttributeProvider* ap = providers.at(i / 2).get();
+      results.append(AttributeSubstitutor::substitute(texts.at(i), ap));
+    }
+    return results;
+  };
+
+  QElapsedTimer timer;
+  timer.start();
+  const QStringList cold = substituteAll();
+  const qint64 coldTime = timer.restart();
+  const QStringList cached = substituteAll();
+  const qint64 cachedTime = timer.elapsed();
+
+  ASSERT_EQ(texts.count(), cold.count());
+  EXPECT_EQ("R0 #0", cold.first().toStdString());
+  EXPECT_EQ(QString("%1k #%1").arg(count - 1), cold.last());
+  EXPECT_EQ(cold, cached);
+  std::cout << "Substituted " << texts.count() << " texts in " << coldTime
+            << "ms (cold) and " << cachedTime << "ms (cached)" << std::endl;
 }
 
 /*******************************************************************************
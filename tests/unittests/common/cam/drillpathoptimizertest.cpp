@@ -0,0 +1,129 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/drillpathoptimizer.h>
+
+#include <QtCore>
+
+#include <algorithm>
+#include <iostream>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class DrillPathOptimizerTest : public ::testing::Test {
+protected:
+  /**
+   * @brief Generate pseudo-random, but reproducible drill hits
+   */
+  static QVector<Point> generatePoints(int count) noexcept {
+    QVector<Point> points;
+    quint32 state = 42;
+    for (int i = 0; i < count; ++i) {
+      state = state * 1103515245u + 12345u;
+      LengthBase_t x = (state >> 8) % 100000;
+      state = state * 1103515245u + 12345u;
+      LengthBase_t y = (state >> 8) % 100000;
+      points.append(Point(x * 1000, y * 1000));  // 100x100mm, 1um grid
+    }
+    return points;
+  }
+
+  static bool isPermutation(QVector<Point> a, QVector<Point> b) noexcept {
+    auto lessThan = [](const Point& p1, const Point& p2) {
+      return (p1.getX() < p2.getX()) ||
+          ((p1.getX() == p2.getX()) && (p1.getY() < p2.getY()));
+    };
+    std::sort(a.begin(), a.end(), lessThan);
+    std::sort(b.begin(), b.end(), lessThan);
+    return a == b;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(DrillPathOptimizerTest, testEmpty) {
+  EXPECT_EQ(QVector<Point>(),
+            DrillPathOptimizer::optimize(QVector<Point>(), Point(0, 0)));
+  EXPECT_EQ(Length(0), DrillPathOptimizer::calcTravelDistance(QVector<Point>(),
+                                                              Point(0, 0)));
+}
+
+TEST_F(DrillPathOptimizerTest, testTravelDistance) {
+  QVector<Point> points = {Point(3000, 4000), Point(3000, 0)};
+  EXPECT_EQ(Length(9000),
+            DrillPathOptimizer::calcTravelDistance(points, Point(0, 0)));
+}
+
+TEST_F(DrillPathOptimizerTest, testZigZag) {
+  QVector<Point> points = {Point(0, 1000), Point(0, 9000), Point(0, 2000),
+                           Point(0, 8000), Point(0, 3000)};
+  QVector<Point> expected = {Point(0, 1000), Point(0, 2000), Point(0, 3000),
+                             Point(0, 8000), Point(0, 9000)};
+  EXPECT_EQ(expected, DrillPathOptimizer::optimize(points, Point(0, 0)));
+}
+
+TEST_F(DrillPathOptimizerTest, testTwoOpt) {
+  QVector<Point> points = generatePoints(500);
+  QVector<Point> optimized = DrillPathOptimizer::optimize(points, Point(0, 0));
+  Length before = DrillPathOptimizer::calcTravelDistance(points, Point(0, 0));
+  Length after = DrillPathOptimizer::calcTravelDistance(optimized, Point(0, 0));
+  std::cout << "Travel distance of 500 hits: " << before.toMm() << "mm => "
+            << after.toMm() << "mm" << std::endl;
+  EXPECT_TRUE(isPermutation(points, optimized));
+  EXPECT_LT(after * 5, before);
+}
+
+TEST_F(DrillPathOptimizerTest, testHilbertCurve) {
+  QVector<Point> points = generatePoints(10000);
+  QVector<Point> optimized = DrillPathOptimizer::optimize(points, Point(0, 0));
+  Length before = DrillPathOptimizer::calcTravelDistance(points, Point(0, 0));
+  Length after = DrillPathOptimizer::calcTravelDistance(optimized, Point(0, 0));
+  std::cout << "Travel distance of 10000 hits: " << before.toMm() << "mm => "
+            << after.toMm() << "mm" << std::endl;
+  EXPECT_TRUE(isPermutation(points, optimized));
+  EXPECT_LT(after * 10, before);
+}
+
+TEST_F(DrillPathOptimizerTest, testDeterministic) {
+  QVector<Point> points = generatePoints(300);
+  EXPECT_EQ(DrillPathOptimizer::optimize(points, Point(0, 0)),
+            DrillPathOptimizer::optimize(points, Point(0, 0)));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,96 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/gerberaperturelist.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GerberApertureListTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GerberApertureListTest, testEmpty) {
+  GerberApertureList list;
+  EXPECT_EQ(
+      "G04 --- APERTURE LIST BEGIN --- *\n"
+      "G04 --- APERTURE LIST END --- *\n",
+      list.generateString().toStdString());
+}
+
+TEST_F(GerberApertureListTest, testDuplicatesAreMerged) {
+  GerberApertureList list;
+  EXPECT_EQ(10, list.setCircle(UnsignedLength(100000), UnsignedLength(0)));
+  EXPECT_EQ(11, list.setRect(UnsignedLength(100000), UnsignedLength(200000),
+                             Angle::deg0(), UnsignedLength(0)));
+  EXPECT_EQ(10, list.setCircle(UnsignedLength(100000), UnsignedLength(0)));
+  EXPECT_EQ(12, list.setCircle(UnsignedLength(100000), UnsignedLength(1000)));
+  // rotation by 180° results in the same aperture, 90° swaps width and height
+  EXPECT_EQ(11, list.setRect(UnsignedLength(100000), UnsignedLength(200000),
+                             Angle::deg180(), UnsignedLength(0)));
+  EXPECT_EQ(11, list.setRect(UnsignedLength(200000), UnsignedLength(100000),
+                             Angle::deg90(), UnsignedLength(0)));
+  EXPECT_EQ(
+      "G04 --- APERTURE LIST BEGIN --- *\n"
+      "%ADD10C,0.1*%\n"
+      "%ADD11R,0.1X0.2*%\n"
+      "%ADD12C,0.1X0.001*%\n"
+      "G04 --- APERTURE LIST END --- *\n",
+      list.generateString().toStdString());
+}
+
+TEST_F(GerberApertureListTest, testMacrosAreAddedOnce) {
+  GerberApertureList list;
+  EXPECT_EQ(10, list.setRect(UnsignedLength(100000), UnsignedLength(200000),
+                             Angle::deg45(), UnsignedLength(0)));
+  EXPECT_EQ(11, list.setRect(UnsignedLength(300000), UnsignedLength(200000),
+                             Angle::deg45(), UnsignedLength(0)));
+  EXPECT_EQ(10, list.setRect(UnsignedLength(100000), UnsignedLength(200000),
+                             Angle::deg45(), UnsignedLength(0)));
+  EXPECT_EQ(
+      "G04 --- APERTURE LIST BEGIN --- *\n"
+      "%AMROTATEDRECT*21,1,$1,$2,0,0,$3*%\n"
+      "%ADD10ROTATEDRECT,0.1X0.2X45.0*%\n"
+      "%ADD11ROTATEDRECT,0.3X0.2X45.0*%\n"
+      "G04 --- APERTURE LIST END --- *\n",
+      list.generateString().toStdString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -721,6 +721,78 @@ TEST_F(TransactionalFileSystemTest, testCheckForModifications) {
   EXPECT_EQ(0, fs.checkForModifications().count());
 }
 
+TEST_F(TransactionalFileSystemTest, testCheckForModificationsSameSize) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("1.txt", "1");  // same content
+  fs.write("2.txt", "X");  // same size, different content
+  fs.write("1/1a.txt", "1a");  // same content
+  fs.write("1/1b.txt", "1c");  // same size, different content
+  fs.write("a/b/c", "");  // different size
+
+  QStringList modified = fs.checkForModifications();
+  std::sort(modified.begin(), modified.end());
+  EXPECT_EQ(QStringList({"1/1b.txt", "2.txt", "a/b/c"}), modified);
+}
+
+TEST_F(TransactionalFileSystemTest, testListingsWithModifications) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  fs.write("x/y/z", "z");  // create new file in new directory
+  fs.write("x/y.txt", "y");  // create new file in new directory
+  fs.write("1/2/new.txt", "new");  // create new file in existing directory
+  fs.removeFile("x/y/z");  // remove new file
+  fs.removeDirRecursively("a");  // remove existing directory
+  fs.removeFile("1/1a.txt");  // remove existing file
+
+  EXPECT_EQ(QSet<QString>({".dot", "1", "foo dir", "x"}),
+            Toolbox::toSet(fs.getDirs()));
+  EXPECT_EQ(QStringList(), fs.getDirs("x"));
+  EXPECT_EQ(QStringList({"y.txt"}), fs.getFiles("x"));
+  EXPECT_EQ(QSet<QString>({"3"}), Toolbox::toSet(fs.getDirs("1/2")));
+  EXPECT_EQ(QStringList({"new.txt"}), fs.getFiles("1/2"));
+  EXPECT_EQ(QStringList({"1b.txt"}), fs.getFiles("1"));
+
+  fs.removeDirRecursively("x");  // remove new directory
+  EXPECT_EQ(QSet<QString>({".dot", "1", "foo dir"}),
+            Toolbox::toSet(fs.getDirs()));
+  EXPECT_EQ(QStringList(), fs.getFiles("x"));
+
+  fs.discardChanges();
+  EXPECT_EQ(QSet<QString>({".dot", "1", "a", "foo dir"}),
+            Toolbox::toSet(fs.getDirs()));
+  EXPECT_EQ(QStringList(), fs.getFiles("1/2"));
+}
+
+TEST_F(TransactionalFileSystemTest, testDiskCache) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  EXPECT_FALSE(fs.isDiskCacheEnabled());
+  fs.setDiskCacheEnabled(true);
+  EXPECT_TRUE(fs.isDiskCacheEnabled());
+  EXPECT_EQ(QSet<QString>({"1.txt", "2.txt", ".lock"}),
+            Toolbox::toSet(fs.getFiles()));
+
+  // modifications on the disk are not visible if the cache is enabled
+  FileUtils::writeFile(mPopulatedDir.getPathTo("3.txt"), "3");
+  EXPECT_EQ(QSet<QString>({"1.txt", "2.txt", ".lock"}),
+            Toolbox::toSet(fs.getFiles()));
+
+  // but modifications in memory are
+  fs.write("4.txt", "4");
+  EXPECT_EQ(QSet<QString>({"1.txt", "2.txt", "4.txt", ".lock"}),
+            Toolbox::toSet(fs.getFiles()));
+
+  // saving clears the cache
+  fs.save();
+  EXPECT_EQ(QSet<QString>({"1.txt", "2.txt", "3.txt", "4.txt", ".lock"}),
+            Toolbox::toSet(fs.getFiles()));
+
+  // disabling clears the cache
+  FileUtils::writeFile(mPopulatedDir.getPathTo("5.txt"), "5");
+  fs.setDiskCacheEnabled(false);
+  EXPECT_EQ(
+      QSet<QString>({"1.txt", "2.txt", "3.txt", "4.txt", "5.txt", ".lock"}),
+      Toolbox::toSet(fs.getFiles()));
+}
+
 /*******************************************************************************
  *  Parametrized getSubDirs() Tests
  ******************************************************************************/
@@ -57,6 +57,22 @@ TEST_F(ToolboxTest, testNoPenBrushReturnsUnmodifiedPath) {
   EXPECT_EQ(path, Toolbox::shapeFromPath(path, pen, brush));
 }
 
+/*******************************************************************************
+ *  removeUnindexedItems() Tests
+ ******************************************************************************/
+
+TEST_F(ToolboxTest, testRemoveUnindexedItems) {
+  struct Item {
+    int id;
+    int getUuid() const noexcept { return id; }
+  };
+  Item a{1}, b{2}, c{3}, d{2};  // d has the same key as b
+  QList<Item*> list = {&a, &b, &c, &d};
+  QHash<int, Item*> index = {{1, &a}, {2, &d}};
+  Toolbox::removeUnindexedItems(list, index);
+  EXPECT_EQ((QList<Item*>{&a, &d}), list);
+}
+
 /*******************************************************************************
  *  Parametrized arcCenter() Tests
  ******************************************************************************/
@@ -0,0 +1,173 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/undocommand.h>
+#include <librepcb/common/undostack.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class UndoStackTest : public ::testing::Test {
+protected:
+  class DummyCommand final : public UndoCommand {
+  public:
+    DummyCommand(int& value, qint64 memoryUsage) noexcept
+      : UndoCommand("Dummy"), mValue(value), mMemoryUsage(memoryUsage) {}
+    qint64 getApproximateMemoryUsage() const noexcept override {
+      return mMemoryUsage;
+    }
+
+  private:
+    bool performExecute() override {
+      performRedo();
+      return true;
+    }
+    void performUndo() override { --mValue; }
+    void performRedo() override { ++mValue; }
+
+    int& mValue;
+    qint64 mMemoryUsage;
+  };
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(UndoStackTest, testMemoryUsage) {
+  int value = 0;
+  UndoStack stack;
+  stack.execCmd(new DummyCommand(value, 100));
+  stack.execCmd(new DummyCommand(value, 200));
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ(300, stack.getMemoryUsage());
+  stack.undo();
+  stack.execCmd(new DummyCommand(value, 50));  // discards the redo command
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ(150, stack.getMemoryUsage());
+  stack.clear();
+  EXPECT_EQ(0, stack.getMemoryUsage());
+}
+
+TEST_F(UndoStackTest, testMaxCommandCount) {
+  int value = 0;
+  UndoStack stack;
+  stack.setMaxCommandCount(3);
+  for (int i = 0; i < 5; ++i) {
+    stack.execCmd(new DummyCommand(value, 10));
+  }
+  EXPECT_EQ(5, value);
+  EXPECT_EQ(3, stack.getCommandCount());
+  EXPECT_EQ(30, stack.getMemoryUsage());
+  while (stack.canUndo()) {
+    stack.undo();
+  }
+  EXPECT_EQ(2, value);  // the oldest two commands were discarded
+}
+
+TEST_F(UndoStackTest, testMaxMemoryUsage) {
+  int value = 0;
+  UndoStack stack;
+  stack.setMaxMemoryUsage(250);
+  stack.execCmd(new DummyCommand(value, 100));
+  stack.execCmd(new DummyCommand(value, 100));
+  EXPECT_EQ(2, stack.getCommandCount());
+  stack.execCmd(new DummyCommand(value, 100));
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ(200, stack.getMemoryUsage());
+}
+
+TEST_F(UndoStackTest, testNewestCommandIsAlwaysKept) {
+  int value = 0;
+  UndoStack stack;
+  stack.setMaxMemoryUsage(100);
+  stack.execCmd(new DummyCommand(value, 1000));
+  stack.execCmd(new DummyCommand(value, 1000));
+  EXPECT_EQ(1, stack.getCommandCount());
+  EXPECT_TRUE(stack.canUndo());
+}
+
+TEST_F(UndoStackTest, testRedoCommandsAreNeverDiscarded) {
+  int value = 0;
+  UndoStack stack;
+  for (int i = 0; i < 4; ++i) {
+    stack.execCmd(new DummyCommand(value, 10));
+  }
+  stack.undo();
+  stack.undo();
+  stack.setMaxCommandCount(1);
+  EXPECT_EQ(3, stack.getCommandCount());  // 1 undo and 2 redo commands
+  EXPECT_TRUE(stack.canUndo());
+  EXPECT_TRUE(stack.canRedo());
+}
+
+TEST_F(UndoStackTest, testCleanIndexIsUpdated) {
+  int value = 0;
+  UndoStack stack;
+  stack.setMaxCommandCount(3);
+  stack.execCmd(new DummyCommand(value, 10));
+  stack.execCmd(new DummyCommand(value, 10));
+  stack.setClean();
+  stack.execCmd(new DummyCommand(value, 10));
+  stack.execCmd(new DummyCommand(value, 10));
+  EXPECT_FALSE(stack.isClean());
+  stack.undo();
+  stack.undo();
+  EXPECT_TRUE(stack.isClean());
+}
+
+TEST_F(UndoStackTest, testCleanStateDiscarded) {
+  int value = 0;
+  UndoStack stack;
+  int discardedSignals = 0;
+  QObject::connect(&stack, &UndoStack::cleanStateDiscarded,
+                   [&discardedSignals]() { ++discardedSignals; });
+  stack.setMaxCommandCount(2);
+  stack.execCmd(new DummyCommand(value, 10));
+  stack.execCmd(new DummyCommand(value, 10));
+  EXPECT_EQ(0, discardedSignals);
+  stack.execCmd(new DummyCommand(value, 10));
+  EXPECT_EQ(1, discardedSignals);
+  stack.execCmd(new DummyCommand(value, 10));
+  EXPECT_EQ(1, discardedSignals);  // emitted only once
+  while (stack.canUndo()) {
+    stack.undo();
+    EXPECT_FALSE(stack.isClean());
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -55,13 +55,14 @@ namespace tests {
  * with Git (i.e. verify if the diff is as expected and makes sense) and then
  * commit those changes.
  */
-class BoardGerberExportTest : public ::testing::Test {};
+class BoardGerberExportTest : public ::testing::TestWithParam<bool> {};
 
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
 
-TEST(BoardGerberExportTest, test) {
+TEST_P(BoardGerberExportTest, test) {
+  const bool parallel = GetParam();
   FilePath testDataDir(TEST_DATA_DIR
                        "/unittests/librepcbproject/BoardGerberExportTest");
 
@@ -80,9 +81,11 @@ TEST(BoardGerberExportTest, test) {
 
   // export fabrication data
   BoardFabricationOutputSettings config = board->getFabricationOutputSettings();
-  config.setOutputBasePath(testDataDir.getPathTo("actual").toStr() %
-                           "/{{PROJECT}}");
+  config.setOutputBasePath(
+      testDataDir.getPathTo(parallel ? "actual-parallel" : "actual").toStr() %
+      "/{{PROJECT}}");
   BoardGerberExport grbExport(*board, config);
+  grbExport.setParallelExportEnabled(parallel);
   grbExport.exportAllLayers();
 
   // replace volatile data in exported files with well-known, constant data
@@ -117,6 +120,15 @@ TEST(BoardGerberExportTest, test) {
   }
 }
 
+/*******************************************************************************
+ *  Test Data
+ ******************************************************************************/
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(BoardGerberExportTest, BoardGerberExportTest,
+                         ::testing::Values(false, true));
+// clang-format on
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
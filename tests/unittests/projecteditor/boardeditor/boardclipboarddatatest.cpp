@@ -39,6 +39,18 @@ namespace tests {
 
 class BoardClipboardDataTest : public ::testing::Test {};
 
+/*******************************************************************************
+ *  Helper Functions
+ ******************************************************************************/
+
+static std::unique_ptr<QMimeData> copyMimeData(const QMimeData& mime) {
+  std::unique_ptr<QMimeData> copy(new QMimeData());
+  foreach (const QString& format, mime.formats()) {
+    copy->setData(format, mime.data(format));
+  }
+  return copy;
+}
+
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
@@ -66,6 +78,22 @@ TEST(BoardClipboardDataTest, testToFromMimeDataEmpty) {
   EXPECT_EQ(obj1.getStrokeTexts(), obj2->getStrokeTexts());
   EXPECT_EQ(obj1.getHoles(), obj2->getHoles());
   EXPECT_EQ(obj1.getPadPositions(), obj2->getPadPositions());
+
+  // Load from a plain copy of the MIME data (like pasting from another
+  // application instance) and validate
+  std::unique_ptr<QMimeData> mime2 = copyMimeData(*mime1);
+  std::unique_ptr<BoardClipboardData> obj3 =
+      BoardClipboardData::fromMimeData(mime2.get());
+  ASSERT_TRUE(obj3);
+  EXPECT_EQ(uuid, obj3->getBoardUuid());
+  EXPECT_EQ(pos, obj3->getCursorPos());
+  EXPECT_EQ(obj1.getDevices(), obj3->getDevices());
+  EXPECT_EQ(obj1.getNetSegments(), obj3->getNetSegments());
+  EXPECT_EQ(obj1.getPlanes(), obj3->getPlanes());
+  EXPECT_EQ(obj1.getPolygons(), obj3->getPolygons());
+  EXPECT_EQ(obj1.getStrokeTexts(), obj3->getStrokeTexts());
+  EXPECT_EQ(obj1.getHoles(), obj3->getHoles());
+  EXPECT_EQ(obj1.getPadPositions(), obj3->getPadPositions());
 }
 
 TEST(BoardClipboardDataTest, testToFromMimeDataPopulated) {
@@ -209,6 +237,22 @@ TEST(BoardClipboardDataTest, testToFromMimeDataPopulated) {
   EXPECT_EQ(obj1.getStrokeTexts(), obj2->getStrokeTexts());
   EXPECT_EQ(obj1.getHoles(), obj2->getHoles());
   EXPECT_EQ(obj1.getPadPositions(), obj2->getPadPositions());
+
+  // Load from a plain copy of the MIME data (like pasting from another
+  // application instance) and validate
+  std::unique_ptr<QMimeData> mime2 = copyMimeData(*mime1);
+  std::unique_ptr<BoardClipboardData> obj3 =
+      BoardClipboardData::fromMimeData(mime2.get());
+  ASSERT_TRUE(obj3);
+  EXPECT_EQ(uuid, obj3->getBoardUuid());
+  EXPECT_EQ(pos, obj3->getCursorPos());
+  EXPECT_EQ(obj1.getDevices(), obj3->getDevices());
+  EXPECT_EQ(obj1.getNetSegments(), obj3->getNetSegments());
+  EXPECT_EQ(obj1.getPlanes(), obj3->getPlanes());
+  EXPECT_EQ(obj1.getPolygons(), obj3->getPolygons());
+  EXPECT_EQ(obj1.getStrokeTexts(), obj3->getStrokeTexts());
+  EXPECT_EQ(obj1.getHoles(), obj3->getHoles());
+  EXPECT_EQ(obj1.getPadPositions(), obj3->getPadPositions());
 }
 
 /*******************************************************************************
@@ -41,6 +41,18 @@ namespace tests {
 
 class SchematicClipboardDataTest : public ::testing::Test {};
 
+/*******************************************************************************
+ *  Helper Functions
+ ******************************************************************************/
+
+static std::unique_ptr<QMimeData> copyMimeData(const QMimeData& mime) {
+  std::unique_ptr<QMimeData> copy(new QMimeData());
+  foreach (const QString& format, mime.formats()) {
+    copy->setData(format, mime.data(format));
+  }
+  return copy;
+}
+
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
@@ -66,6 +78,20 @@ TEST(SchematicClipboardDataTest, testToFromMimeDataEmpty) {
   EXPECT_EQ(obj1.getSymbolInstances(), obj2->getSymbolInstances());
   EXPECT_EQ(obj1.getPolygons(), obj2->getPolygons());
   EXPECT_EQ(obj1.getTexts(), obj2->getTexts());
+
+  // Load from a plain copy of the MIME data (like pasting from another
+  // application instance) and validate
+  std::unique_ptr<QMimeData> mime2 = copyMimeData(*mime1);
+  std::unique_ptr<SchematicClipboardData> obj3 =
+      SchematicClipboardData::fromMimeData(mime2.get());
+  ASSERT_TRUE(obj3);
+  EXPECT_EQ(uuid, obj3->getSchematicUuid());
+  EXPECT_EQ(pos, obj3->getCursorPos());
+  EXPECT_EQ(obj1.getComponentInstances(), obj3->getComponentInstances());
+  EXPECT_EQ(obj1.getNetSegments(), obj3->getNetSegments());
+  EXPECT_EQ(obj1.getSymbolInstances(), obj3->getSymbolInstances());
+  EXPECT_EQ(obj1.getPolygons(), obj3->getPolygons());
+  EXPECT_EQ(obj1.getTexts(), obj3->getTexts());
 }
 
 TEST(SchematicClipboardDataTest, testToFromMimeDataPopulated) {
@@ -188,6 +214,20 @@ TEST(SchematicClipboardDataTest, testToFromMimeDataPopulated) {
   EXPECT_EQ(obj1.getSymbolInstances(), obj2->getSymbolInstances());
   EXPECT_EQ(obj1.getPolygons(), obj2->getPolygons());
   EXPECT_EQ(obj1.getTexts(), obj2->getTexts());
+
+  // Load from a plain copy of the MIME data (like pasting from another
+  // application instance) and validate
+  std::unique_ptr<QMimeData> mime2 = copyMimeData(*mime1);
+  std::unique_ptr<SchematicClipboardData> obj3 =
+      SchematicClipboardData::fromMimeData(mime2.get());
+  ASSERT_TRUE(obj3);
+  EXPECT_EQ(uuid, obj3->getSchematicUuid());
+  EXPECT_EQ(pos, obj3->getCursorPos());
+  EXPECT_EQ(obj1.getComponentInstances(), obj3->getComponentInstances());
+  EXPECT_EQ(obj1.getNetSegments(), obj3->getNetSegments());
+  EXPECT_EQ(obj1.getSymbolInstances(), obj3->getSymbolInstances());
+  EXPECT_EQ(obj1.getPolygons(), obj3->getPolygons());
+  EXPECT_EQ(obj1.getTexts(), obj3->getTexts());
 }
 
 /*******************************************************************************
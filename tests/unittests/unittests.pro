@@ -81,6 +81,8 @@ SOURCES += \
     common/attributes/attributetypetest.cpp \
     common/attributes/attributeunittest.cpp \
     common/boarddesignrulestest.cpp \
+    common/cam/drillpathoptimizertest.cpp \
+    common/cam/gerberaperturelisttest.cpp \
     common/circuitidentifiertest.cpp \
     common/fileio/csvfiletest.cpp \
     common/fileio/directorylocktest.cpp \
@@ -113,6 +115,7 @@ SOURCES += \
     common/units/pointtest.cpp \
     common/units/ratiotest.cpp \
     common/utils/mathparsertest.cpp \
+    common/undostacktest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
     common/widgets/editabletablewidgettest.cpp \
@@ -141,6 +144,7 @@ SOURCES += \
     project/projecttest.cpp \
     projecteditor/boardeditor/boardclipboarddatatest.cpp \
     projecteditor/schematiceditor/schematicclipboarddatatest.cpp \
+    workspace/library/workspacelibrarydbtest.cpp \
     workspace/settings/workspacesettingstest.cpp \
     workspace/workspacetest.cpp \
 
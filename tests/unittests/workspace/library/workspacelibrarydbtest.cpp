@@ -0,0 +1,269 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/sqlitedatabase.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/workspace.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class WorkspaceLibraryDbTest : public ::testing::Test {
+protected:
+  FilePath mWsDir;
+  QScopedPointer<Workspace> mWs;
+  QScopedPointer<SQLiteDatabase> mDb;
+
+  WorkspaceLibraryDbTest() {
+    mWsDir = FilePath::getRandomTempPath().getPathTo("workspace");
+    Workspace::createNewWorkspace(mWsDir);  // can throw
+    mWs.reset(new Workspace(mWsDir));  // can throw
+    mDb.reset(new SQLiteDatabase(mWs->getLibraryDb().getFilePath()));
+  }
+
+  virtual ~WorkspaceLibraryDbTest() {
+    mDb.reset();
+    mWs.reset();
+    QDir(mWsDir.getParentDir().toStr()).removeRecursively();
+  }
+
+  int addCategory(const QString& table, const QString& uuid,
+                  const QString& version, const QString& parent) {
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT INTO " % table %
+        " (lib_id, filepath, uuid, version, parent_uuid) "
+        "VALUES (0, :filepath, :uuid, :version, :parent_uuid)");
+    query.bindValue(":filepath", uuid % "/" % version);
+    query.bindValue(":uuid", uuid);
+    query.bindValue(":version", version);
+    query.bindValue(":parent_uuid", parent.isEmpty() ? QVariant() : parent);
+    return mDb->insert(query);  // can throw
+  }
+
+  void addTranslation(const QString& table, int id, const QString& locale,
+                      const QString& name,
+                      const QString& description = QString()) {
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT INTO " % table % "_tr (cat_id, locale, name, description) "
+        "VALUES (:id, :locale, :name, :description)");
+    query.bindValue(":id", id);
+    query.bindValue(":locale", locale);
+    query.bindValue(":name", name);
+    query.bindValue(":description",
+                    description.isNull() ? QVariant() : description);
+    mDb->insert(query);  // can throw
+  }
+
+  void addElement(const QString& table, const QString& idrowname,
+                  const QString& category) {
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT INTO " % table %
+        " (lib_id, filepath, uuid, version) "
+        "VALUES (0, :filepath, :uuid, '0.1')");
+    QString uuid = Uuid::createRandom().toStr();
+    query.bindValue(":filepath", uuid);
+    query.bindValue(":uuid", uuid);
+    int id = mDb->insert(query);  // can throw
+    if (!category.isEmpty()) {
+      query = mDb->prepareQuery("INSERT INTO " % table % "_cat (" % idrowname %
+                                ", category_uuid) VALUES (:id, :category)");
+      query.bindValue(":id", id);
+      query.bindValue(":category", category);
+      mDb->insert(query);  // can throw
+    }
+  }
+
+  int addLibrary(const QString& filepath) {
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT INTO libraries (filepath, uuid, version) "
+        "VALUES (:filepath, :uuid, '0.1')");
+    query.bindValue(":filepath", filepath);
+    query.bindValue(":uuid", Uuid::createRandom().toStr());
+    return mDb->insert(query);  // can throw
+  }
+
+  int addSymbol(int libId, const QString& filepath, const QString& uuid,
+                const QString& version) {
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT INTO symbols (lib_id, filepath, uuid, version) "
+        "VALUES (:lib_id, :filepath, :uuid, :version)");
+    query.bindValue(":lib_id", libId);
+    query.bindValue(":filepath", filepath);
+    query.bindValue(":uuid", uuid);
+    query.bindValue(":version", version);
+    return mDb->insert(query);  // can throw
+  }
+
+  void addSymbolTranslation(int id, const QString& locale,
+                            const QString& name) {
+    QSqlQuery query = mDb->prepareQuery(
+        "INSERT INTO symbols_tr (symbol_id, locale, name) "
+        "VALUES (:id, :locale, :name)");
+    query.bindValue(":id", id);
+    query.bindValue(":locale", locale);
+    query.bindValue(":name", name.isNull() ? QVariant() : name);
+    mDb->insert(query);  // can throw
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testGetComponentCategoryTree) {
+  const QString table = "component_categories";
+  const QString parent = "6a3cbb06-1b8c-4f7b-9d1b-a8e4ad1b3e42";
+  const QString child = "0ac8f09c-1d1e-4a0b-8e0b-40c7b4b1e2f7";
+  addTranslation(table, addCategory(table, parent, "0.2", ""), "en_US",
+                 "New Name", "New Description");
+  addTranslation(table, addCategory(table, parent, "0.1", ""), "en_US",
+                 "Old Name", "Old Description");
+  int childId = addCategory(table, child, "0.1", parent);
+  addTranslation(table, childId, "en_US", "Child");
+  addTranslation(table, childId, "de_DE", " Invalid Name ");
+  addCategory(table, "invalid uuid", "0.1", "");
+  addElement("symbols", "symbol_id", child);
+  addElement("symbols", "symbol_id", "");
+  addElement("components", "component_id", parent);
+  addElement("components", "component_id", child);
+  addElement("components", "component_id", child);
+
+  WorkspaceLibraryDb::CategoryTree tree =
+      mWs->getLibraryDb().getComponentCategoryTree({"de_DE", "en_US"});
+
+  // names and descriptions of the latest versions, invalid rows are skipped
+  EXPECT_EQ(2, tree.names.count());
+  EXPECT_EQ("New Name", tree.names.value(parent));
+  EXPECT_EQ("New Description", tree.descriptions.value(parent));
+  EXPECT_EQ("Child", tree.names.value(child));
+
+  // parent-child relations
+  EXPECT_EQ(QSet<Uuid>{Uuid::fromString(parent)}, tree.childs.value(""));
+  EXPECT_EQ(QSet<Uuid>{Uuid::fromString(child)}, tree.childs.value(parent));
+  EXPECT_TRUE(tree.childs.value(child).isEmpty());
+
+  // element counts
+  EXPECT_EQ(1, tree.symbolCounts.value(child));
+  EXPECT_EQ(1, tree.symbolCounts.value(""));  // without category
+  EXPECT_EQ(0, tree.symbolCounts.value(parent));
+  EXPECT_EQ(1, tree.componentCounts.value(parent));
+  EXPECT_EQ(2, tree.componentCounts.value(child));
+  EXPECT_TRUE(tree.deviceCounts.isEmpty());
+  EXPECT_TRUE(tree.packageCounts.isEmpty());
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetPackageCategoryTree) {
+  const QString table = "package_categories";
+  const QString parent = "9b0a6b4e-6a1c-4c3b-8f5e-0d2a7c1f3b64";
+  const QString child = "f2d4e6a8-3b5c-4d7e-9f01-2a3b4c5d6e7f";
+  addTranslation(table, addCategory(table, parent, "0.1", ""), "en_US",
+                 "Parent");
+  addTranslation(table, addCategory(table, child, "0.1", parent), "en_US",
+                 "Child");
+  addElement("packages", "package_id", child);
+  addElement("packages", "package_id", child);
+
+  WorkspaceLibraryDb::CategoryTree tree =
+      mWs->getLibraryDb().getPackageCategoryTree({"en_US"});
+
+  EXPECT_EQ(2, tree.names.count());
+  EXPECT_EQ("Parent", tree.names.value(parent));
+  EXPECT_EQ("Child", tree.names.value(child));
+  EXPECT_EQ(QSet<Uuid>{Uuid::fromString(parent)}, tree.childs.value(""));
+  EXPECT_EQ(QSet<Uuid>{Uuid::fromString(child)}, tree.childs.value(parent));
+  EXPECT_EQ(2, tree.packageCounts.value(child));
+  EXPECT_EQ(0, tree.packageCounts.value(parent));
+  EXPECT_TRUE(tree.symbolCounts.isEmpty());
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetLibraryElementsMetadata) {
+  const QString uuid1 = "3b8e2c5a-7f41-4d0e-9a6b-1c2d3e4f5a6b";
+  const QString uuid2 = "5d7f9b1c-2e4a-4c6e-8a0b-3c5d7e9f1a2b";
+  const QString uuid3 = "8a1c3e5f-7b9d-4f1a-b3c5-d7e9f1a3b5c7";
+  const QString uuid4 = "c2e4a6b8-d0f2-4a4c-9e6a-8b0c2d4e6f8a";
+  int libId = addLibrary("lib.lplib");
+  int otherLibId = addLibrary("other.lplib");
+
+  // several locales, the first matching one of the locale order is used
+  int id1 = addSymbol(libId, "lib.lplib/sym/" % uuid1, uuid1, "1.2");
+  addSymbolTranslation(id1, "en_US", "Resistor");
+  addSymbolTranslation(id1, "de_DE", "Widerstand");
+  addSymbolTranslation(id1, "fr_FR", "Resistance");
+  // no translation at all
+  addSymbol(libId, "lib.lplib/sym/" % uuid2, uuid2, "0.1");
+  // NULL names are ignored
+  int id3 = addSymbol(libId, "lib.lplib/sym/" % uuid3, uuid3, "0.3");
+  addSymbolTranslation(id3, "de_DE", QString());
+  addSymbolTranslation(id3, "en_US", "Capacitor");
+  // only translations which are not in the locale order
+  int id4 = addSymbol(libId, "lib.lplib/sym/" % uuid4, uuid4, "2");
+  addSymbolTranslation(id4, "fr_FR", "Diode");
+  // element of another library
+  int otherId = addSymbol(otherLibId, "other.lplib/sym/" % uuid1, uuid1, "1");
+  addSymbolTranslation(otherId, "en_US", "Other");
+
+  const FilePath libsDir = mWs->getLibrariesPath();
+  QList<WorkspaceLibraryDb::ElementMetadata> elements =
+      mWs->getLibraryDb().getLibraryElementsMetadata<library::Symbol>(
+          libsDir.getPathTo("lib.lplib"), {"de_DE", "en_US"});
+  ASSERT_EQ(4, elements.count());
+
+  EXPECT_EQ(libsDir.getPathTo("lib.lplib/sym/" % uuid1), elements[0].filePath);
+  EXPECT_EQ(Uuid::fromString(uuid1), elements[0].uuid);
+  EXPECT_EQ(Version::fromString("1.2"), elements[0].version);
+  EXPECT_EQ("Widerstand", elements[0].name.toStdString());
+
+  EXPECT_EQ(libsDir.getPathTo("lib.lplib/sym/" % uuid2), elements[1].filePath);
+  EXPECT_EQ(Uuid::fromString(uuid2), elements[1].uuid);
+  EXPECT_EQ(Version::fromString("0.1"), elements[1].version);
+  EXPECT_EQ("unknown", elements[1].name.toStdString());
+
+  EXPECT_EQ(libsDir.getPathTo("lib.lplib/sym/" % uuid3), elements[2].filePath);
+  EXPECT_EQ(Uuid::fromString(uuid3), elements[2].uuid);
+  EXPECT_EQ(Version::fromString("0.3"), elements[2].version);
+  EXPECT_EQ("Capacitor", elements[2].name.toStdString());
+
+  EXPECT_EQ(libsDir.getPathTo("lib.lplib/sym/" % uuid4), elements[3].filePath);
+  EXPECT_EQ(Uuid::fromString(uuid4), elements[3].uuid);
+  EXPECT_EQ(Version::fromString("2"), elements[3].version);
+  EXPECT_EQ("unknown", elements[3].name.toStdString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace workspace
+}  // namespace librepcb
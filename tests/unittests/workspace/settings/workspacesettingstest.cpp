@@ -123,7 +123,10 @@ TEST_F(WorkspaceSettingsTest, testStoreAndLoad) {
   obj1.applicationLocale.set("de_CH");
   obj1.defaultLengthUnit.set(LengthUnit::nanometers());
   obj1.projectAutosaveIntervalSeconds.set(1234);
+  obj1.undoStackMaxCommands.set(42);
+  obj1.undoStackMaxMemoryMiB.set(64);
   obj1.useOpenGl.set(!obj1.useOpenGl.get());
+  obj1.usePartialViewportUpdates.set(!obj1.usePartialViewportUpdates.get());
   obj1.libraryLocaleOrder.set({"de_CH", "en_US"});
   obj1.libraryNormOrder.set({"foo", "bar"});
   obj1.repositoryUrls.set({QUrl("https://foo"), QUrl("https://bar")});
@@ -141,7 +144,12 @@ TEST_F(WorkspaceSettingsTest, testStoreAndLoad) {
   EXPECT_EQ(obj1.defaultLengthUnit.get(), obj2.defaultLengthUnit.get());
   EXPECT_EQ(obj1.projectAutosaveIntervalSeconds.get(),
             obj2.projectAutosaveIntervalSeconds.get());
+  EXPECT_EQ(obj1.undoStackMaxCommands.get(), obj2.undoStackMaxCommands.get());
+  EXPECT_EQ(obj1.undoStackMaxMemoryMiB.get(),
+            obj2.undoStackMaxMemoryMiB.get());
   EXPECT_EQ(obj1.useOpenGl.get(), obj2.useOpenGl.get());
+  EXPECT_EQ(obj1.usePartialViewportUpdates.get(),
+            obj2.usePartialViewportUpdates.get());
   EXPECT_EQ(obj1.libraryLocaleOrder.get(), obj2.libraryLocaleOrder.get());
   EXPECT_EQ(obj1.libraryNormOrder.get(), obj2.libraryNormOrder.get());
   EXPECT_EQ(obj1.repositoryUrls.get(), obj2.repositoryUrls.get());